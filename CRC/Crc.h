@@ -0,0 +1,206 @@
+/*
+ * Crc.h
+ *
+ *  Created on: 16.10.2026
+ *      Author: agent
+ *
+ *  Description:
+ *    Generic CRC engine, parameterized according to the well-known "Rocksoft" model (width, polynomial, initial
+ *    value, input/output reflection, final XOR). The lookup table gets generated at compile time, separately for
+ *    each instantiation - i.e. only the tables of the CRC variants being used end up in Flash.
+ *    All calculations can be performed within constant expressions as well.
+ *
+ *    Example:
+ *      static_assert( Util::Crc16_Modbus::calculate("123456789", 9) == 0x4B37, "" );
+ *
+ *      Util::Crc16_CcittFalse crc;
+ *      crc.update(frameHeader, sizeof(frameHeader)).update(payload, payloadLength);
+ *      uint16_t checksum = crc.value();
+ */
+#ifndef UTIL_CRC_CRC_H_
+#define UTIL_CRC_CRC_H_
+
+#include <stdint-gcc.h>
+#include <stddef.h>
+#include <type_traits>
+
+
+namespace Util {
+
+	namespace CrcInternal {
+
+		template <typename T>
+		struct Table {
+			T entries[256];
+		};
+
+		/// Mirrors the lowest 'nBits' bits of a value.
+		template <typename T>
+		constexpr T reflect(T value, uint_fast8_t nBits) {
+			T reflected = 0;
+			for (uint_fast8_t bitNum = 0; bitNum < nBits; bitNum++) {
+				reflected = static_cast<T>( (reflected << 1) | (value & 1) );
+				value >>= 1;
+			}
+			return reflected;
+		}
+
+		/// Reflected variants operate LSB first, using the mirrored polynomial.
+		template <typename T>
+		constexpr Table<T> generateTable(uint_fast8_t width, T polynomial, bool reflectInput) {
+			const T topBit = static_cast<T>( static_cast<T>(1) << (width - 1) );
+			const T mask   = static_cast<T>( (topBit - 1) | topBit );
+			const T reflectedPolynomial = reflect<T>(polynomial, width);
+			Table<T> table {};
+			for (uint_fast16_t i = 0; i<256; i++) {
+				T remainder = 0;
+				if ( reflectInput ) {
+					remainder = static_cast<T>(i);
+					for (uint_fast8_t bitNum = 8; bitNum > 0; --bitNum)
+						remainder = (remainder & 1)  ?  static_cast<T>((remainder >> 1) ^ reflectedPolynomial)  :  static_cast<T>(remainder >> 1);
+				} else {
+					remainder = static_cast<T>( static_cast<T>(i) << (width - 8) );
+					for (uint_fast8_t bitNum = 8; bitNum > 0; --bitNum)
+						remainder = (remainder & topBit)  ?  static_cast<T>((remainder << 1) ^ polynomial)  :  static_cast<T>(remainder << 1);
+				}
+				table.entries[i] = static_cast<T>( remainder & mask );
+			}
+			return table;
+		}
+
+	} /* namespace CrcInternal */
+
+	template <uint_fast8_t Width, uint64_t Polynomial, uint64_t InitialValue, bool ReflectInput, bool ReflectOutput, uint64_t FinalXor>
+	class Crc {
+		static_assert( Width >= 8  &&  Width <= 64, "Width must be within range [8 .. 64]!" );
+
+		public:
+			/// Smallest unsigned integer type that is capable of holding the CRC.
+			using value_t = typename std::conditional<(Width <= 8),  uint8_t,
+							typename std::conditional<(Width <= 16), uint16_t,
+							typename std::conditional<(Width <= 32), uint32_t,
+																	 uint64_t>::type>::type>::type;
+
+		private:
+			static constexpr value_t Mask   = static_cast<value_t>( (Width == 64) ? ~UINT64_C(0) : ((UINT64_C(1) << Width) - 1) );
+
+			static_assert( (Polynomial & ~static_cast<uint64_t>(Mask)) == 0, "Polynomial exceeds the CRC width!" );
+			static_assert( (InitialValue & ~static_cast<uint64_t>(Mask)) == 0, "Initial value exceeds the CRC width!" );
+			static_assert( (FinalXor & ~static_cast<uint64_t>(Mask)) == 0, "Final XOR value exceeds the CRC width!" );
+
+			using Table = CrcInternal::Table<value_t>;
+			static constexpr Table LookupTable = CrcInternal::generateTable<value_t>(Width, Polynomial, ReflectInput);
+
+			/// Register contents at start, in the (possibly reflected) representation used during calculation.
+			static constexpr value_t StartRemainder = ReflectInput  ?  CrcInternal::reflect<value_t>(InitialValue, Width)  :  static_cast<value_t>(InitialValue);
+
+			template <typename TByte>
+			static constexpr value_t updateRemainder(value_t remainder, TByte const *bytes, size_t nBytes) {
+				for (size_t byteNum = 0; byteNum < nBytes; byteNum++) {
+					const uint8_t byte = static_cast<uint8_t>(bytes[byteNum]);
+					if ( ReflectInput )
+						remainder = static_cast<value_t>( (remainder >> 8) ^ LookupTable.entries[(remainder ^ byte) & 0xFF] );
+					else
+						remainder = static_cast<value_t>( ((remainder << 8) ^ LookupTable.entries[((remainder >> (Width - 8)) ^ byte) & 0xFF]) & Mask );
+				}
+				return remainder;
+			}
+
+			static constexpr value_t finalize(value_t remainder) {
+				if ( ReflectInput != ReflectOutput )  remainder = CrcInternal::reflect<value_t>(remainder, Width);
+				return static_cast<value_t>( remainder ^ FinalXor );
+			}
+
+			/// Inverse of @see finalize.
+			static constexpr value_t unfinalize(value_t crc) {
+				crc = static_cast<value_t>( crc ^ FinalXor );
+				if ( ReflectInput != ReflectOutput )  crc = CrcInternal::reflect<value_t>(crc, Width);
+				return crc;
+			}
+
+			value_t _remainder;
+
+		public:
+			/**
+			 * Constructor. Starts a new (incremental) calculation.
+			 */
+			constexpr Crc() : _remainder(StartRemainder) {}
+
+			/**
+			 * Constructor. Continues a calculation whose intermediate CRC has been obtained by @see value(), e.g. after
+			 * storing it in a plain C struct.
+			 */
+			explicit constexpr Crc(value_t intermediateCrc) : _remainder(unfinalize(intermediateCrc)) {}
+
+			/**
+			 * Restarts the calculation.
+			 */
+			void reset() {
+				_remainder = StartRemainder;
+			}
+
+			/**
+			 * Feeds data bytes into the calculation. The data may be split into chunks of any size.
+			 *
+			 * @param bytes   	..	Data bytes. May be nullptr if nBytes is 0.
+			 * @param nBytes  	..	Number of data bytes
+			 * @return        	..	Returns a reference to this instance, so that calls can be chained.
+			 */
+			constexpr Crc& update(uint8_t const *bytes, size_t nBytes) {
+				_remainder = updateRemainder(_remainder, bytes, nBytes);
+				return *this;
+			}
+			constexpr Crc& update(char const *bytes, size_t nBytes) {
+				_remainder = updateRemainder(_remainder, bytes, nBytes);
+				return *this;
+			}
+			Crc& update(void const *bytes, size_t nBytes) {
+				return update( static_cast<uint8_t const *>(bytes), nBytes );
+			}
+
+			/**
+			 * Returns the CRC over all data bytes fed so far. Further data may be fed afterwards.
+			 */
+			constexpr value_t value() const {
+				return finalize(_remainder);
+			}
+
+			/**
+			 * Determines the CRC over a single contiguous data buffer.
+			 *
+			 * @param bytes   	..	Data bytes. May be nullptr if nBytes is 0.
+			 * @param nBytes  	..	Number of data bytes
+			 * @return        	..	Returns the CRC
+			 */
+			static constexpr value_t calculate(uint8_t const *bytes, size_t nBytes) {
+				return finalize( updateRemainder(StartRemainder, bytes, nBytes) );
+			}
+			static constexpr value_t calculate(char const *bytes, size_t nBytes) {
+				return finalize( updateRemainder(StartRemainder, bytes, nBytes) );
+			}
+			static value_t calculate(void const *bytes, size_t nBytes) {
+				return calculate( static_cast<uint8_t const *>(bytes), nBytes );
+			}
+
+	}; /* class Crc */
+
+	template <uint_fast8_t Width, uint64_t Polynomial, uint64_t InitialValue, bool ReflectInput, bool ReflectOutput, uint64_t FinalXor>
+	constexpr CrcInternal::Table<typename Crc<Width, Polynomial, InitialValue, ReflectInput, ReflectOutput, FinalXor>::value_t> Crc<Width, Polynomial, InitialValue, ReflectInput, ReflectOutput, FinalXor>::LookupTable;
+
+
+	/// Commonly used parameter sets. The comments state the CRC over the ASCII string "123456789".
+	using Crc8_Nrsc5       = Crc< 8, 0x31,       0xFF,       false, false, 0x00>;        	///< 0xF7. Equals @see calculateCrc8
+	using Crc8_SmBus       = Crc< 8, 0x07,       0x00,       false, false, 0x00>;        	///< 0xF4
+	using Crc8_Maxim       = Crc< 8, 0x31,       0x00,       true,  true,  0x00>;        	///< 0xA1. Dallas/Maxim 1-Wire
+	using Crc16_CcittFalse = Crc<16, 0x1021,     0xFFFF,     false, false, 0x0000>;      	///< 0x29B1
+	using Crc16_XModem     = Crc<16, 0x1021,     0x0000,     false, false, 0x0000>;      	///< 0x31C3
+	using Crc16_Kermit     = Crc<16, 0x1021,     0x0000,     true,  true,  0x0000>;      	///< 0x2189. Also known as "CRC-16/CCITT"
+	using Crc16_Modbus     = Crc<16, 0x8005,     0xFFFF,     true,  true,  0x0000>;      	///< 0x4B37
+	using Crc32_IsoHdlc    = Crc<32, 0x04C11DB7, 0xFFFFFFFF, true,  true,  0xFFFFFFFF>;  	///< 0xCBF43926. Ethernet, zlib, PNG
+	using Crc32_Mpeg2      = Crc<32, 0x04C11DB7, 0xFFFFFFFF, false, false, 0x00000000>;  	///< 0x0376E6E7. STM32 hardware CRC unit (default settings)
+	using Crc32_Castagnoli = Crc<32, 0x1EDC6F41, 0xFFFFFFFF, true,  true,  0xFFFFFFFF>;  	///< 0xE3069283. iSCSI, SSE4.2
+
+} /* namespace Util */
+
+
+#endif /* UTIL_CRC_CRC_H_ */
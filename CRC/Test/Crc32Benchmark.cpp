@@ -0,0 +1,92 @@
+/*
+ * Crc32Benchmark.cpp
+ *
+ *  Created on: 16.10.2026
+ *      Author: agent
+ *
+ *  Description:
+ *  	Throughput benchmark of the CRC-32 backends. Intended to be run on the (Linux) host. On x86 hosts, cycles/byte
+ *  	are measured using the time stamp counter (TSC), which counts at the nominal clock printed along the results.
+ */
+
+#include "../crc32.h"
+#include "Crc32Benchmark.h"
+
+#include <chrono>
+#include <stdio.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+	#include <x86intrin.h>
+#endif
+
+
+namespace Util {
+
+	namespace {
+		constexpr size_t WordCount = 4 * 1024 * 1024 / sizeof(uint32_t);  // 4 MiB, i.e. a typical Flash dump
+		uint32_t Words[WordCount];
+	}
+
+
+	uint64_t Crc32Benchmark::readCycleCounter() {
+		#if defined(__x86_64__) || defined(__i386__)
+			return __rdtsc();
+		#else
+			return 0;
+		#endif
+	}
+
+	Crc32Benchmark::Measurement Crc32Benchmark::measure( Crc32Function function, uint32_t const words[], size_t nWords ) {
+		constexpr int Repetitions = 5;
+		double bestSeconds = 1e9;
+		uint64_t bestCycles = UINT64_MAX;
+		volatile uint32_t sink;
+		for (int i = 0; i<Repetitions; i++) {
+			const auto start = std::chrono::steady_clock::now();
+			const uint64_t startCycles = readCycleCounter();
+			sink = function( words, nWords );
+			const uint64_t cycles = readCycleCounter() - startCycles;
+			const std::chrono::duration<double> duration = std::chrono::steady_clock::now() - start;
+			if ( duration.count() < bestSeconds )  bestSeconds = duration.count();
+			if ( cycles < bestCycles )  bestCycles = cycles;
+		}
+		(void)sink;
+		const double byteCount = static_cast<double>( nWords * sizeof(uint32_t) );
+		return { byteCount / bestSeconds / 1e9, bestCycles / byteCount };
+	}
+
+	void Crc32Benchmark::performAllBenchmarks() {
+		uint32_t pseudoRandom = 0x2545F491;
+		for (auto &word : Words) {
+			pseudoRandom ^= pseudoRandom << 13;  pseudoRandom ^= pseudoRandom >> 17;  pseudoRandom ^= pseudoRandom << 5;
+			word = pseudoRandom;
+		}
+
+		const struct {
+			const char *name;
+			Crc32Function function;
+		} backends[] = {
+			{ "bitwise",      calculateCrc32_bitwise },
+			{ "nibble table", calculateCrc32_nibbleTable },
+			{ "byte table",   calculateCrc32_byteTable },
+			{ "slice-by-8",   calculateCrc32_sliceBy8 },
+			{ "clmul",        calculateCrc32_clmul },
+		};
+
+		// Determines the TSC clock, so that cycles/byte can be related to GB/s
+		const auto start = std::chrono::steady_clock::now();
+		const uint64_t startCycles = readCycleCounter();
+		while ( std::chrono::steady_clock::now() - start < std::chrono::milliseconds(200) ) {}
+		const std::chrono::duration<double> duration = std::chrono::steady_clock::now() - start;
+		const double cycleCounterGigahertz = (readCycleCounter() - startCycles) / duration.count() / 1e9;
+
+		const uint32_t expected = calculateCrc32_bitwise( Words, WordCount );
+		printf( "CRC-32 throughput over %u kB (TSC at %.2f GHz):\n", static_cast<unsigned>(sizeof(Words) / 1024), cycleCounterGigahertz );
+		for (const auto &backend : backends) {
+			const bool matches = backend.function(Words, WordCount) == expected;
+			const Measurement result = measure( backend.function, Words, WordCount );
+			printf( "  %-14s %7.2f GB/s  %6.2f cycles/byte%s\n", backend.name, result.gigabytesPerSecond, result.cyclesPerByte, matches ? "" : "  (RESULT MISMATCH!)" );
+		}
+	}
+
+} /* namespace Util */
@@ -0,0 +1,44 @@
+/*
+ * Crc32Benchmark.h
+ *
+ *  Created on: 16.10.2026
+ *      Author: agent
+ *
+ *  Description:
+ *  	Throughput benchmark of the CRC-32 backends. Intended to be run on the (Linux) host. On x86 hosts, cycles/byte
+ *  	are measured using the time stamp counter (TSC), which counts at the nominal clock printed along the results.
+ */
+
+#ifndef UTIL_CRC_TEST_CRC32_BENCHMARK_H_
+#define UTIL_CRC_TEST_CRC32_BENCHMARK_H_
+
+#include <stdint-gcc.h>
+#include <stddef.h>
+
+
+namespace Util {
+
+	class Crc32Benchmark {
+			Crc32Benchmark() = delete;
+
+		public:
+			/**
+			 * Runs all benchmarks and prints the results to stdout.
+			 */
+			static void performAllBenchmarks();
+
+		private:
+			typedef uint32_t (*Crc32Function)(uint32_t const words[], size_t nWords);
+
+			struct Measurement {
+				double gigabytesPerSecond;
+				double cyclesPerByte;       ///< TSC cycles; 0 if there is no TSC.
+			};
+
+			static Measurement measure( Crc32Function function, uint32_t const words[], size_t nWords );
+			static uint64_t readCycleCounter();
+	};
+
+} /* namespace Util */
+
+#endif /* UTIL_CRC_TEST_CRC32_BENCHMARK_H_ */
@@ -0,0 +1,121 @@
+/*
+ * Crc32Test.cpp
+ *
+ *  Created on: 16.10.2026
+ *      Author: agent
+ *
+ *  Description:
+ *  	Tests for CRC-32 module.
+ */
+
+#include "../crc32.h"
+#include "Crc32Test.h"
+
+#include <array>
+#include <string.h>
+
+
+namespace Util {
+
+	void Crc32Test::assertTrue( bool value ) {
+		if ( !value )  while(1){}
+	}
+
+	void Crc32Test::assertEquals( uint32_t expected, uint32_t value ) {
+		if ( expected != value )  while(1){}
+	}
+
+
+	void Crc32Test::performAllTests() {
+		performTest_KnownValues();
+		performTest_AllBackendsBitExact();
+		performTest_Streaming();
+		performTest_Combine();
+	}
+
+	/**
+	 * The expected values were determined using the original bitwise implementation. They must never change, otherwise
+	 * existing persistence images in Flash won't validate anymore.
+	 */
+	void Crc32Test::performTest_KnownValues() {
+		const uint32_t words[] = { 0x12345678, 0x9ABCDEF0, 0, 0xFFFFFFFF, 0xDEADBEEF, 1, 2, 3, 4, 5, 6 };
+
+		assertEquals( 0xFFFFFFFF, calculateCrc32(words, 0) );
+		assertEquals( 0x3FCD27AA, calculateCrc32(words, 1) );
+		assertEquals( 0x1808B77C, calculateCrc32(words, 11) );
+	}
+
+	void Crc32Test::performTest_AllBackendsBitExact() {
+		static std::array<uint32_t, 101> words;  // Long enough to pass the main loop of the clmul backend several times
+		uint32_t pseudoRandom = 0x2545F491;
+		for (auto &word : words) {
+			pseudoRandom ^= pseudoRandom << 13;  pseudoRandom ^= pseudoRandom >> 17;  pseudoRandom ^= pseudoRandom << 5;
+			word = pseudoRandom;
+		}
+
+		for (size_t nWords = 0; nWords <= words.size(); nWords++) {
+			const uint32_t expected = calculateCrc32_bitwise( words.data(), nWords );
+			assertEquals( expected, calculateCrc32_nibbleTable(words.data(), nWords) );
+			assertEquals( expected, calculateCrc32_byteTable(words.data(), nWords) );
+			assertEquals( expected, calculateCrc32_sliceBy8(words.data(), nWords) );
+			assertEquals( expected, calculateCrc32_clmul(words.data(), nWords) );
+			assertEquals( expected, calculateCrc32(words.data(), nWords) );
+		}
+		assertTrue( calculateCrc32_bitwise(words.data(), words.size()) != calculateCrc32_bitwise(words.data(), words.size()-1) );
+	}
+
+	/**
+	 * Feeds the same words in chunks of varying sizes, starting at unaligned addresses.
+	 */
+	void Crc32Test::performTest_Streaming() {
+		std::array<uint32_t, 19> words;
+		for (size_t i = 0; i<words.size(); i++)  words[i] = UINT32_C(0x9E3779B9) * (i + 1);
+		const uint32_t expected = calculateCrc32( words.data(), words.size() );
+
+		std::array<uint8_t, sizeof(words) + 3> buffer;
+		for (size_t offset = 0; offset<4; offset++) {
+			memcpy( &buffer[offset], words.data(), sizeof(words) );
+			for (size_t chunkSize = 1; chunkSize <= 37; chunkSize++) {
+				Crc32Context context;
+				initializeCrc32( &context );
+				for (size_t pos = 0; pos < sizeof(words); pos += chunkSize) {
+					const size_t remaining = sizeof(words) - pos;
+					updateCrc32( &context, &buffer[offset+pos], (remaining < chunkSize) ? remaining : chunkSize );
+				}
+				assertEquals( expected, finalizeCrc32(&context) );
+			}
+		}
+
+		// Incomplete data words get padded using zero bytes
+		Crc32Context context;
+		initializeCrc32( &context );
+		updateCrc32( &context, words.data(), 2*sizeof(uint32_t) + 1 );
+		uint32_t paddedWords[3] = { words[0], words[1], 0 };
+		memcpy( &paddedWords[2], &words[2], 1 );
+		assertEquals( calculateCrc32(paddedWords, 3), finalizeCrc32(&context) );
+
+		// Finalizing doesn't change the context
+		updateCrc32( &context, reinterpret_cast<uint8_t const *>(words.data()) + 2*sizeof(uint32_t) + 1, 3 );
+		assertEquals( calculateCrc32(words.data(), 3), finalizeCrc32(&context) );
+	}
+
+	void Crc32Test::performTest_Combine() {
+		std::array<uint32_t, 23> words;
+		for (size_t i = 0; i<words.size(); i++)  words[i] = UINT32_C(0x85EBCA6B) * (i + 7);
+		const uint32_t expected = calculateCrc32( words.data(), words.size() );
+
+		for (size_t split = 0; split <= words.size(); split++) {
+			const uint32_t crcA = calculateCrc32( words.data(), split );
+			const uint32_t crcB = calculateCrc32( words.data() + split, words.size() - split );
+			assertEquals( expected, combineCrc32(crcA, crcB, words.size() - split) );
+		}
+
+		// Three blocks, merged pairwise
+		const uint32_t crc1 = calculateCrc32( words.data(), 5 );
+		const uint32_t crc2 = calculateCrc32( words.data() + 5, 11 );
+		const uint32_t crc3 = calculateCrc32( words.data() + 16, 7 );
+		assertEquals( expected, combineCrc32(crc1, combineCrc32(crc2, crc3, 7), 18) );
+		assertEquals( expected, combineCrc32(combineCrc32(crc1, crc2, 11), crc3, 7) );
+	}
+
+} /* namespace Util */
@@ -0,0 +1,39 @@
+/*
+ * Crc32Test.h
+ *
+ *  Created on: 16.10.2026
+ *      Author: agent
+ *
+ *  Description:
+ *  	Tests for CRC-32 module.
+ */
+
+#ifndef UTIL_CRC_TEST_CRC32_TEST_H_
+#define UTIL_CRC_TEST_CRC32_TEST_H_
+
+#include <stdint-gcc.h>
+#include <stddef.h>
+
+
+namespace Util {
+
+	class Crc32Test {
+			Crc32Test() = delete;
+
+		public:
+			static void performAllTests();
+
+		private:
+			static void assertTrue( bool value );
+			static void assertEquals( uint32_t expected, uint32_t value );
+
+			static void performTest_KnownValues();
+			static void performTest_AllBackendsBitExact();
+			static void performTest_Streaming();
+			static void performTest_Combine();
+
+	};
+
+} /* namespace Util */
+
+#endif /* UTIL_CRC_TEST_CRC32_TEST_H_ */
@@ -0,0 +1,94 @@
+/*
+ * CrcTest.cpp
+ *
+ *  Created on: 16.10.2026
+ *      Author: agent
+ *
+ *  Description:
+ *  	Tests for generic CRC engine.
+ */
+
+#include "../Crc.h"
+#include "CrcTest.h"
+
+extern "C" {
+	#include "../crc8.h"
+}
+
+
+namespace Util {
+
+	namespace {
+		constexpr char CheckString[] = "123456789";
+		constexpr size_t CheckStringLength = sizeof(CheckString) - 1;
+
+		// The following checks are evaluated at compile time
+		static_assert( Crc8_Nrsc5::calculate(CheckString, CheckStringLength)       == 0xF7, "" );
+		static_assert( Crc8_SmBus::calculate(CheckString, CheckStringLength)       == 0xF4, "" );
+		static_assert( Crc8_Maxim::calculate(CheckString, CheckStringLength)       == 0xA1, "" );
+		static_assert( Crc16_CcittFalse::calculate(CheckString, CheckStringLength) == 0x29B1, "" );
+		static_assert( Crc16_XModem::calculate(CheckString, CheckStringLength)     == 0x31C3, "" );
+		static_assert( Crc16_Kermit::calculate(CheckString, CheckStringLength)     == 0x2189, "" );
+		static_assert( Crc16_Modbus::calculate(CheckString, CheckStringLength)     == 0x4B37, "" );
+		static_assert( Crc32_IsoHdlc::calculate(CheckString, CheckStringLength)    == 0xCBF43926, "" );
+		static_assert( Crc32_Mpeg2::calculate(CheckString, CheckStringLength)      == 0x0376E6E7, "" );
+		static_assert( Crc32_Castagnoli::calculate(CheckString, CheckStringLength) == 0xE3069283, "" );
+		static_assert( Crc<64, 0x42F0E1EBA9EA3693, ~UINT64_C(0), true, true, ~UINT64_C(0)>::calculate(CheckString, CheckStringLength) == 0x995DC9BBDF1939FA, "CRC-64/XZ" );
+		static_assert( Crc16_Modbus().update(CheckString, 4).update(CheckString+4, CheckStringLength-4).value() == 0x4B37, "" );
+
+		// Continuing from an intermediate CRC
+		using Crc16_Mixed = Crc<16, 0x1021, 0xFFFF, true, false, 0x1234>;
+		static_assert( Crc32_IsoHdlc(Crc32_IsoHdlc().update(CheckString, 4).value()).update(CheckString+4, CheckStringLength-4).value() == 0xCBF43926, "" );
+		static_assert( Crc16_Mixed(Crc16_Mixed().update(CheckString, 4).value()).update(CheckString+4, CheckStringLength-4).value() == Crc16_Mixed::calculate(CheckString, CheckStringLength), "" );
+	}
+
+
+	void CrcTest::assertEquals( uint64_t expected, uint64_t value ) {
+		if ( expected != value )  while(1){}
+	}
+
+
+	void CrcTest::performAllTests() {
+		performTest_CheckValues();
+		performTest_EqualsCrc8Module();
+		performTest_Incremental();
+	}
+
+	void CrcTest::performTest_CheckValues() {
+		volatile size_t length = CheckStringLength;  // Enforces evaluation at runtime
+		assertEquals( 0xF7, Crc8_Nrsc5::calculate(CheckString, length) );
+		assertEquals( 0x29B1, Crc16_CcittFalse::calculate(CheckString, length) );
+		assertEquals( 0x4B37, Crc16_Modbus::calculate(CheckString, length) );
+		assertEquals( 0xCBF43926, Crc32_IsoHdlc::calculate(CheckString, length) );
+		assertEquals( 0x0376E6E7, Crc32_Mpeg2::calculate(CheckString, length) );
+	}
+
+	void CrcTest::performTest_EqualsCrc8Module() {
+		uint8_t bytes[64];
+		for (size_t i = 0; i<sizeof(bytes); i++)  bytes[i] = static_cast<uint8_t>(i * 37 + 11);
+
+		for (size_t nBytes = 0; nBytes <= sizeof(bytes); nBytes++)
+			assertEquals( calculateCrc8(bytes, nBytes), Crc8_Nrsc5::calculate(bytes, nBytes) );
+		assertEquals( 0xF7, calculateCrc8(reinterpret_cast<uint8_t const *>(CheckString), CheckStringLength) );
+
+		// Incremental calculation via the C context, in chunks of growing size
+		Crc8Context context;
+		initializeCrc8( &context );
+		for (size_t offset = 0, chunkSize = 0; offset < sizeof(bytes); offset += chunkSize++) {
+			const size_t nBytes = (offset + chunkSize <= sizeof(bytes))  ?  chunkSize  :  sizeof(bytes) - offset;
+			updateCrc8( &context, &bytes[offset], nBytes );
+		}
+		assertEquals( Crc8_Nrsc5::calculate(bytes, sizeof(bytes)), finalizeCrc8(&context) );
+	}
+
+	void CrcTest::performTest_Incremental() {
+		Crc16_Kermit crc;
+		for (size_t i = 0; i<CheckStringLength; i++)
+			crc.update( &CheckString[i], 1 );
+		assertEquals( 0x2189, crc.value() );
+
+		crc.reset();
+		assertEquals( Crc16_Kermit::calculate(CheckString, 0), crc.value() );
+	}
+
+} /* namespace Util */
@@ -0,0 +1,36 @@
+/*
+ * CrcTest.h
+ *
+ *  Created on: 16.10.2026
+ *      Author: agent
+ *
+ *  Description:
+ *  	Tests for generic CRC engine.
+ */
+
+#ifndef UTIL_CRC_TEST_CRC_TEST_H_
+#define UTIL_CRC_TEST_CRC_TEST_H_
+
+#include <stdint-gcc.h>
+
+
+namespace Util {
+
+	class CrcTest {
+			CrcTest() = delete;
+
+		public:
+			static void performAllTests();
+
+		private:
+			static void assertEquals( uint64_t expected, uint64_t value );
+
+			static void performTest_CheckValues();
+			static void performTest_EqualsCrc8Module();
+			static void performTest_Incremental();
+
+	};
+
+} /* namespace Util */
+
+#endif /* UTIL_CRC_TEST_CRC_TEST_H_ */
@@ -0,0 +1,324 @@
+/*
+ * crc32.cpp
+ *
+ *  Created on: 29.11.2017
+ *      Author: Robert Voelckner
+ *
+ *  Description:
+ *    This module provides functionality to calculate CRC-32.
+ *
+ *    Per data word, the remainder gets XORed with the word and is subsequently shifted by 8 bits (MSB first). All table
+ *    driven backends replicate exactly this behaviour, so their results equal the ones of the bitwise backend.
+ *    The tables are generated at compile time.
+ */
+#include "crc32.h"
+
+#include <stdint-gcc.h>
+#include <stddef.h>
+#include <string.h>
+
+
+namespace {
+
+	/// Shifts the remainder by one bit (MSB first) and applies the polynomial if necessary.
+	constexpr uint32_t shiftOneBit(uint32_t remainder) {
+		return (remainder & CRC32_TOPBIT)  ?  (remainder << 1) ^ CRC32_POLYNOMIAL  :  (remainder << 1);
+	}
+
+	/// Shifts the remainder by the given number of bits.
+	constexpr uint32_t shiftBits(uint32_t remainder, uint_fast8_t nBits) {
+		for (uint_fast8_t bitNum = nBits; bitNum > 0; --bitNum)
+			remainder = shiftOneBit(remainder);
+		return remainder;
+	}
+
+	template <size_t TEntryCount>
+	struct Table {
+		uint32_t entries[TEntryCount];
+		constexpr uint32_t operator[](size_t i) const { return entries[i]; }
+	};
+
+	/// Contains the results of shifting each nibble value (located in the topmost 4 bits) by 4 bits.
+	constexpr Table<16> generateNibbleTable() {
+		Table<16> table {};
+		for (uint32_t i = 0; i<16; i++)
+			table.entries[i] = shiftBits(i << 28, 4);
+		return table;
+	}
+
+	/// Contains the results of shifting each byte value (located in the topmost 8 bits) by 8 bits.
+	constexpr Table<256> generateByteTable() {
+		Table<256> table {};
+		for (uint32_t i = 0; i<256; i++)
+			table.entries[i] = shiftBits(i << 24, 8);
+		return table;
+	}
+
+	/// Slice n contains the results of shifting each byte value by (32 + 8*n) bits. Slice 0 equals the byte table.
+	struct SliceTables {
+		Table<256> slices[8];
+	};
+
+	constexpr SliceTables generateSliceBy8Tables() {
+		SliceTables tables {};
+		tables.slices[0] = generateByteTable();
+		for (size_t slice = 1; slice<8; slice++)
+			for (uint32_t i = 0; i<256; i++)
+				tables.slices[slice].entries[i] = shiftBits(tables.slices[slice-1][i], 8);
+		return tables;
+	}
+
+	constexpr Table<16>      NibbleTable    = generateNibbleTable();
+	constexpr Table<256>     ByteTable      = generateByteTable();
+	constexpr SliceTables    SliceBy8Tables = generateSliceBy8Tables();
+
+	static_assert( NibbleTable[1] == CRC32_POLYNOMIAL  &&  ByteTable[1] == CRC32_POLYNOMIAL, "Table generation is broken!" );
+	static_assert( SliceBy8Tables.slices[0][0xFF] == ByteTable[0xFF], "Table generation is broken!" );
+
+
+	/// Shifts the remainder by 32 bits, i.e. determines (remainder * x^32) mod polynomial.
+	inline uint32_t shift32(uint32_t remainder) {
+		const auto &s = SliceBy8Tables.slices;
+		return s[3][remainder >> 24] ^ s[2][(remainder >> 16) & 0xFF] ^ s[1][(remainder >> 8) & 0xFF] ^ s[0][remainder & 0xFF];
+	}
+
+	/// Shifts the remainder by 64 bits, i.e. determines (remainder * x^64) mod polynomial.
+	inline uint32_t shift64(uint32_t remainder) {
+		const auto &s = SliceBy8Tables.slices;
+		return s[7][remainder >> 24] ^ s[6][(remainder >> 16) & 0xFF] ^ s[5][(remainder >> 8) & 0xFF] ^ s[4][remainder & 0xFF];
+	}
+
+
+	/// The following functions shift the remainder by 8 bits, i.e. they complete the processing of one data word.
+	inline uint32_t shiftWordBitwise(uint32_t remainder) {
+		for (uint8_t bitNum = 8; bitNum > 0; --bitNum) {
+			if (remainder & CRC32_TOPBIT) {
+				remainder = (remainder << 1) ^ CRC32_POLYNOMIAL;
+			} else {
+				remainder = (remainder << 1);
+			}
+		}
+		return remainder;
+	}
+
+	inline uint32_t shiftWordNibbleTable(uint32_t remainder) {
+		remainder = (remainder << 4) ^ NibbleTable[remainder >> 28];
+		remainder = (remainder << 4) ^ NibbleTable[remainder >> 28];
+		return remainder;
+	}
+
+	inline uint32_t shiftWordByteTable(uint32_t remainder) {
+		return (remainder << 8) ^ ByteTable[remainder >> 24];
+	}
+
+
+	/// Loads a data word. Unaligned words are fetched using memcpy(), which the compiler maps to the best suited load instruction(s).
+	template <bool TAligned>
+	inline uint32_t loadWord(void const *words, size_t wordNum) {
+		if ( TAligned )  return static_cast<uint32_t const *>(words)[wordNum];
+		uint32_t word;
+		memcpy( &word, static_cast<uint8_t const *>(words) + wordNum*sizeof(uint32_t), sizeof(uint32_t) );
+		return word;
+	}
+
+
+	/// The following functions continue a CRC-32 calculation from the given remainder over a number of data words.
+	template <bool TAligned>
+	uint32_t updateBitwise(uint32_t remainder, void const *words, size_t nWords) {
+		for (size_t wordNum = 0; wordNum < nWords; ++wordNum) {
+			remainder ^= (loadWord<TAligned>(words, wordNum) << (CRC32_WIDTH - 32));
+			remainder = shiftWordBitwise(remainder);
+		}
+		return remainder;
+	}
+
+	template <bool TAligned>
+	uint32_t updateNibbleTable(uint32_t remainder, void const *words, size_t nWords) {
+		for (size_t wordNum = 0; wordNum < nWords; ++wordNum) {
+			remainder ^= loadWord<TAligned>(words, wordNum);
+			remainder = shiftWordNibbleTable(remainder);
+		}
+		return remainder;
+	}
+
+	template <bool TAligned>
+	uint32_t updateByteTable(uint32_t remainder, void const *words, size_t nWords) {
+		for (size_t wordNum = 0; wordNum < nWords; ++wordNum) {
+			remainder ^= loadWord<TAligned>(words, wordNum);
+			remainder = shiftWordByteTable(remainder);
+		}
+		return remainder;
+	}
+
+	/**
+	 * Processes blocks of 8 words per iteration. Since every word is shifted by 8 bits only, the lower 24 bits of the
+	 * words 1..3 of each half block can be folded into the remainder before the 32 bit shift, leaving only their upper
+	 * parts to be XORed afterwards. Thereby all table lookups of one block are independent of each other.
+	 */
+	template <bool TAligned>
+	uint32_t updateSliceBy8(uint32_t remainder, void const *words, size_t nWords) {
+		size_t wordNum = 0;
+		for ( ; wordNum + 8 <= nWords; wordNum += 8) {
+			const uint32_t w0 = loadWord<TAligned>(words, wordNum),   w1 = loadWord<TAligned>(words, wordNum+1);
+			const uint32_t w2 = loadWord<TAligned>(words, wordNum+2), w3 = loadWord<TAligned>(words, wordNum+3);
+			const uint32_t w4 = loadWord<TAligned>(words, wordNum+4), w5 = loadWord<TAligned>(words, wordNum+5);
+			const uint32_t w6 = loadWord<TAligned>(words, wordNum+6), w7 = loadWord<TAligned>(words, wordNum+7);
+
+			const uint32_t lowerHalf = remainder ^ w0 ^ (w1 >> 8) ^ (w2 >> 16) ^ (w3 >> 24);
+			const uint32_t lowerRest = (w1 << 24) ^ (w2 << 16) ^ (w3 << 8);
+			const uint32_t upperHalf = lowerRest ^ w4 ^ (w5 >> 8) ^ (w6 >> 16) ^ (w7 >> 24);
+			const uint32_t upperRest = (w5 << 24) ^ (w6 << 16) ^ (w7 << 8);
+			remainder = shift64(lowerHalf) ^ shift32(upperHalf) ^ upperRest;
+		}
+		for ( ; wordNum < nWords; ++wordNum) {
+			remainder ^= loadWord<TAligned>(words, wordNum);
+			remainder = shiftWordByteTable(remainder);
+		}
+		return remainder;
+	}
+
+
+	/// The following functions forward to the backend that was selected by CRC32_IMPLEMENTATION.
+	inline uint32_t shiftWord(uint32_t remainder) {
+		#if CRC32_IMPLEMENTATION == CRC32_IMPLEMENTATION_BITWISE
+			return shiftWordBitwise(remainder);
+		#elif CRC32_IMPLEMENTATION == CRC32_IMPLEMENTATION_NIBBLE_TABLE
+			return shiftWordNibbleTable(remainder);
+		#elif CRC32_IMPLEMENTATION == CRC32_IMPLEMENTATION_BYTE_TABLE || CRC32_IMPLEMENTATION == CRC32_IMPLEMENTATION_SLICE_BY_8
+			return shiftWordByteTable(remainder);
+		#else
+			#error Unknown CRC32_IMPLEMENTATION!
+		#endif
+	}
+
+	template <bool TAligned>
+	inline uint32_t update(uint32_t remainder, void const *words, size_t nWords) {
+		#if CRC32_IMPLEMENTATION == CRC32_IMPLEMENTATION_BITWISE
+			return updateBitwise<TAligned>(remainder, words, nWords);
+		#elif CRC32_IMPLEMENTATION == CRC32_IMPLEMENTATION_NIBBLE_TABLE
+			return updateNibbleTable<TAligned>(remainder, words, nWords);
+		#elif CRC32_IMPLEMENTATION == CRC32_IMPLEMENTATION_BYTE_TABLE
+			return updateByteTable<TAligned>(remainder, words, nWords);
+		#elif CRC32_IMPLEMENTATION == CRC32_IMPLEMENTATION_SLICE_BY_8
+			return updateSliceBy8<TAligned>(remainder, words, nWords);
+		#else
+			#error Unknown CRC32_IMPLEMENTATION!
+		#endif
+	}
+
+	/// Multiplies two polynomials modulo the CRC polynomial.
+	uint32_t multiplyModP(uint32_t a, uint32_t b) {
+		uint32_t product = 0;
+		for (uint32_t bit = CRC32_TOPBIT; bit != 0; bit >>= 1) {
+			product = shiftOneBit(product);
+			if ( b & bit )  product ^= a;
+		}
+		return product;
+	}
+
+	/// Determines x^(8*nWords) mod P, i.e. the factor each data word shifts the remainder by. Uses square-and-multiply.
+	uint32_t wordShiftFactor(size_t nWords) {
+		uint32_t factor = 1;
+		uint32_t power = UINT32_C(1) << 8;
+		for ( ; nWords > 0; nWords >>= 1) {
+			if ( nWords & 1 )  factor = multiplyModP(factor, power);
+			power = multiplyModP(power, power);
+		}
+		return factor;
+	}
+
+	/// Determines the bit position of a byte within its data word, regarding native byte order.
+	inline uint_fast8_t bytePosition(uint_fast8_t byteNum) {
+		#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+			return 8 * (sizeof(uint32_t) - 1 - byteNum);
+		#else
+			return 8 * byteNum;
+		#endif
+	}
+
+} /* anonymous namespace */
+
+
+
+uint32_t calculateCrc32_bitwise(uint32_t const words[], size_t nWords) {
+	return updateBitwise<true>(CRC32_STARTVALUE, words, nWords);
+}
+
+uint32_t calculateCrc32_nibbleTable(uint32_t const words[], size_t nWords) {
+	return updateNibbleTable<true>(CRC32_STARTVALUE, words, nWords);
+}
+
+uint32_t calculateCrc32_byteTable(uint32_t const words[], size_t nWords) {
+	return updateByteTable<true>(CRC32_STARTVALUE, words, nWords);
+}
+
+uint32_t calculateCrc32_sliceBy8(uint32_t const words[], size_t nWords) {
+	return updateSliceBy8<true>(CRC32_STARTVALUE, words, nWords);
+}
+
+
+#ifdef __GNUC__
+	__attribute__((weak)) /*Allows to override the following CRC-32 implmentation by the application*/
+#endif
+uint32_t calculateCrc32(uint32_t const words[], size_t nWords) {
+	return update<true>(CRC32_STARTVALUE, words, nWords);
+}
+
+
+void initializeCrc32(Crc32Context *context) {
+	context->remainder = CRC32_STARTVALUE;
+	context->pendingByteCount = 0;
+}
+
+
+/**
+ * Bytes of an incomplete data word are XORed directly into the remainder at their word position. As soon as the
+ * word is complete, the remainder gets shifted. This way, no staging buffer is necessary.
+ */
+void updateCrc32(Crc32Context *context, void const *bytes, size_t nBytes) {
+	uint8_t const *bytePtr = static_cast<uint8_t const *>(bytes);
+	uint32_t remainder = context->remainder;
+	uint_fast8_t pendingByteCount = context->pendingByteCount;
+
+	// Complete a previously started data word
+	for ( ; nBytes > 0  &&  pendingByteCount > 0; nBytes--) {
+		remainder ^= static_cast<uint32_t>(*bytePtr++) << bytePosition(pendingByteCount);
+		if ( ++pendingByteCount >= sizeof(uint32_t) ) {
+			remainder = shiftWord(remainder);
+			pendingByteCount = 0;
+		}
+	}
+
+	// Process all complete data words in one go
+	const size_t nWords = nBytes / sizeof(uint32_t);
+	if ( (reinterpret_cast<uintptr_t>(bytePtr) % alignof(uint32_t)) == 0 )
+		remainder = update<true>(remainder, bytePtr, nWords);
+	else
+		remainder = update<false>(remainder, bytePtr, nWords);
+	bytePtr += nWords * sizeof(uint32_t);
+	nBytes  -= nWords * sizeof(uint32_t);
+
+	// Start a new data word with the remaining bytes
+	for ( ; nBytes > 0; nBytes--) {
+		remainder ^= static_cast<uint32_t>(*bytePtr++) << bytePosition(pendingByteCount++);
+	}
+
+	context->remainder = remainder;
+	context->pendingByteCount = pendingByteCount;
+}
+
+
+/**
+ * With n words, calculateCrc32 yields  (start * x^(8n) + M * x^8) mod P, where M is the polynomial of the data words.
+ * Hence  crc(A|B) = (crcA ^ start) * x^(8 nWordsB)  ^  crcB  (mod P).
+ */
+uint32_t combineCrc32(uint32_t crcA, uint32_t crcB, size_t nWordsB) {
+	return multiplyModP( crcA ^ CRC32_STARTVALUE, wordShiftFactor(nWordsB) ) ^ crcB;
+}
+
+
+uint32_t finalizeCrc32(Crc32Context const *context) {
+	if ( context->pendingByteCount > 0 )
+		return shiftWord(context->remainder);
+	return context->remainder;
+}
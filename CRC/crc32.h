@@ -6,6 +6,21 @@
  *
  *  Description:
  *    This module provides functionality to calculate CRC-32.
+ *
+ *    The calculation backend of @see calculateCrc32 can be chosen at compile time by defining CRC32_IMPLEMENTATION
+ *    to one of the CRC32_IMPLEMENTATION_xx values below. All backends deliver bit-exact identical results, so data that
+ *    was protected by one backend (e.g. persistence images in Flash) validates with any other one.
+ *
+ *      Backend        Table size   Host cycles/byte     Host GB/s
+ *      -------------  -----------  ----------------     ---------
+ *      BITWISE            0 bytes   ~5.7                 ~0.37
+ *      NIBBLE_TABLE      64 bytes   ~2.7                 ~0.76
+ *      BYTE_TABLE      1024 bytes   ~1.5                 ~1.44
+ *      SLICE_BY_8      8192 bytes   ~0.34                ~6.2
+ *      (clmul)           64 bytes   ~0.11                ~18     x86 hosts only, see calculateCrc32_clmul
+ *
+ *    Measured by CRC/Test/Crc32Benchmark (x86-64 Xeon, g++ 12 -O2, 4 MiB input, best of 5). The cycles are counted by
+ *    the time stamp counter, which runs at 2.1 GHz on that host.
  */
 #ifndef APPLICATION_USER_PERSISTENCEMANAGER_CRC32_H_
 #define APPLICATION_USER_PERSISTENCEMANAGER_CRC32_H_
@@ -24,17 +39,90 @@ extern "C" {
 	#define CRC32_POLYNOMIAL  UINT32_C(0x04C11DB7)   /*!<  X^32 + X^26 + X^23 + X^22 + X^16 + X^12 + X^11 + X^10 +X^8 + X^7 + X^5 + X^4 + X^2+ X +1 */
 	#define CRC32_STARTVALUE  UINT32_C(0xFFFFFFFF)
 
+	/// Available calculation backends of @see calculateCrc32
+	#define CRC32_IMPLEMENTATION_BITWISE       0   /*!< No table. Smallest code, slowest execution. */
+	#define CRC32_IMPLEMENTATION_NIBBLE_TABLE  1   /*!< 16 entries table (64 bytes Flash). */
+	#define CRC32_IMPLEMENTATION_BYTE_TABLE    2   /*!< 256 entries table (1 kB Flash). */
+	#define CRC32_IMPLEMENTATION_SLICE_BY_8    3   /*!< 8x 256 entries tables (8 kB Flash). Processes 8 words per iteration. */
+
+	#ifndef CRC32_IMPLEMENTATION
+		#define CRC32_IMPLEMENTATION  CRC32_IMPLEMENTATION_BYTE_TABLE
+	#endif
+
 	/**
 	 * Determines the CRC-32 over an amount of data words at the following conditions:
 	 *   - Polynomial  = CRC32_POLYNOMIAL
 	 *   - Start value = CRC32_STARTVALUE
 	 *
+	 * @remark The backend being used is selected by CRC32_IMPLEMENTATION.
+	 *
 	 * @param words   	..	Data words (each of 32 bits)
 	 * @param nWords  	..	Number of data words
 	 * @return         	..	Returns the CRC-32
 	 */
 	extern uint32_t calculateCrc32(uint32_t const words[], size_t nWords);
 
+	/// Context of an incremental CRC-32 calculation. Must be initialized using @see initializeCrc32 before usage.
+	typedef struct {
+		uint32_t remainder;         ///< Remainder after all completed data words.
+		uint8_t  pendingByteCount;  ///< Number of bytes of the current (not yet completed) data word. Range: [0 .. 3]
+	} Crc32Context;
+
+	/**
+	 * Initializes a context for incremental CRC-32 calculation.
+	 *
+	 * @param context 	..	The context to be initialized.
+	 */
+	extern void initializeCrc32(Crc32Context *context);
+
+	/**
+	 * Feeds an arbitrary amount of data bytes into an incremental CRC-32 calculation. The bytes need not be aligned,
+	 * and the data may be split into chunks of any size. Four consecutive bytes form one data word, using the native
+	 * byte order. Thus, feeding the memory of a word array yields the same CRC as @see calculateCrc32 does.
+	 *
+	 * @param context 	..	The context, initialized by @see initializeCrc32
+	 * @param bytes   	..	Data bytes. May be NULL if nBytes is 0.
+	 * @param nBytes  	..	Number of data bytes
+	 */
+	extern void updateCrc32(Crc32Context *context, void const *bytes, size_t nBytes);
+
+	/**
+	 * Returns the CRC-32 over all data bytes fed so far. If their number is no multiple of 4, the last data word gets
+	 * padded using zero bytes. The context remains unchanged, so further data may be fed afterwards.
+	 *
+	 * @param context 	..	The context, initialized by @see initializeCrc32
+	 * @return         	..	Returns the CRC-32
+	 */
+	extern uint32_t finalizeCrc32(Crc32Context const *context);
+
+	/**
+	 * Determines the CRC-32 over the concatenation of two data word blocks A and B, using only their CRCs and the length
+	 * of block B. This allows to calculate the CRCs of several blocks independently (e.g. in parallel or time-sliced)
+	 * and to merge them afterwards. Requires O(log nWordsB) operations.
+	 *
+	 * @param crcA     	..	CRC-32 of block A, as returned by @see calculateCrc32
+	 * @param crcB     	..	CRC-32 of block B, as returned by @see calculateCrc32
+	 * @param nWordsB  	..	Number of data words of block B
+	 * @return         	..	Returns the CRC-32 of A followed by B
+	 */
+	extern uint32_t combineCrc32(uint32_t crcA, uint32_t crcB, size_t nWordsB);
+
+	/**
+	 * The following functions provide direct access to the single backends of @see calculateCrc32. They take the same
+	 * parameters and return the same results. Usually, the application should call @see calculateCrc32 instead.
+	 */
+	extern uint32_t calculateCrc32_bitwise(uint32_t const words[], size_t nWords);
+	extern uint32_t calculateCrc32_nibbleTable(uint32_t const words[], size_t nWords);
+	extern uint32_t calculateCrc32_byteTable(uint32_t const words[], size_t nWords);
+	extern uint32_t calculateCrc32_sliceBy8(uint32_t const words[], size_t nWords);
+
+	/**
+	 * Host (x86) backend, using carry-less multiplication if supported by the CPU at runtime. Falls back to
+	 * @see calculateCrc32_sliceBy8 otherwise. Worthwhile for large amounts of data, e.g. Flash dumps. Implemented
+	 * within crc32_clmul.cpp, which only needs to be compiled if this function is used.
+	 */
+	extern uint32_t calculateCrc32_clmul(uint32_t const words[], size_t nWords);
+
 
 #ifdef __cplusplus
 } /* extern "C" */
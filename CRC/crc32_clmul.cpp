@@ -0,0 +1,150 @@
+/*
+ * crc32_clmul.cpp
+ *
+ *  Created on: 16.10.2026
+ *      Author: agent
+ *
+ *  Description:
+ *    Provides a CRC-32 backend for x86 hosts (e.g. tooling that verifies Flash dumps), based on carry-less
+ *    multiplication (PCLMULQDQ). Availability of the instruction is checked at runtime; if it is missing, or
+ *    if not compiling for x86, the slice-by-8 backend is used instead. The results equal @see calculateCrc32.
+ *
+ *    Background: calculateCrc32 determines  (start * x^(8n)  +  sum(word[i] * x^(8(n-1-i))) * x^8)  mod P.
+ *    Eight consecutive words therefore form one polynomial of 88 bits, and consecutive blocks of 8 words are
+ *    x^64 apart. Four such blocks are kept in independent 128 bit accumulators, which get folded forward by
+ *    x^256 per iteration. Finally, the accumulators are folded into one and reduced byte by byte.
+ */
+#include "crc32.h"
+
+#include <stdint-gcc.h>
+#include <stddef.h>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+	#define CRC32_CLMUL_AVAILABLE
+	#include <immintrin.h>
+#endif
+
+
+#ifdef CRC32_CLMUL_AVAILABLE
+namespace {
+
+	constexpr size_t WordsPerBlock   = 8;
+	constexpr size_t AccumulatorCount = 4;
+	constexpr size_t MinimumWordCount = 2 * WordsPerBlock * AccumulatorCount;
+
+	/// Determines x^exponent mod P
+	constexpr uint32_t xPowerModP(uint_fast16_t exponent) {
+		uint32_t remainder = 1;
+		for ( ; exponent > 0; exponent--)
+			remainder = (remainder & CRC32_TOPBIT)  ?  (remainder << 1) ^ CRC32_POLYNOMIAL  :  (remainder << 1);
+		return remainder;
+	}
+
+	/// Determines (remainder * x^8) mod P, i.e. performs one shift step of the bitwise algorithm.
+	inline uint32_t shiftByte(uint32_t remainder) {
+		for (uint8_t bitNum = 8; bitNum > 0; --bitNum)
+			remainder = (remainder & CRC32_TOPBIT)  ?  (remainder << 1) ^ CRC32_POLYNOMIAL  :  (remainder << 1);
+		return remainder;
+	}
+
+	/// Multiplies the 128 bit polynomial 'value' by x^distance (modulo P, result not fully reduced).
+	template <uint_fast16_t Distance>
+	__attribute__((target("pclmul,ssse3"))) inline __m128i fold(__m128i value) {
+		constexpr uint32_t UpperConstant = xPowerModP(Distance + 64), LowerConstant = xPowerModP(Distance);
+		const __m128i constants = _mm_set_epi64x( UpperConstant, LowerConstant );
+		return _mm_xor_si128( _mm_clmulepi64_si128(value, constants, 0x11), _mm_clmulepi64_si128(value, constants, 0x00) );
+	}
+
+	/// Shuffle mask n moves the 8 bytes of the n-th 64 bit lane (of two interleaved half blocks) to byte offset (3-n). Entries of -1 yield zero bytes.
+	struct ShuffleMasks {
+		int8_t masks[4][16];
+	};
+
+	constexpr ShuffleMasks generateShuffleMasks() {
+		ShuffleMasks shuffleMasks {};
+		for (int laneNum = 0; laneNum < 4; laneNum++)
+			for (int destinationByte = 0; destinationByte < 16; destinationByte++) {
+				const int laneByte = destinationByte - (3 - laneNum);
+				shuffleMasks.masks[laneNum][destinationByte] = static_cast<int8_t>( (laneByte >= 0 && laneByte < 8)  ?  8*(laneNum % 2) + laneByte  :  -1 );
+			}
+		return shuffleMasks;
+	}
+
+	alignas(16) constexpr ShuffleMasks LaneShuffleMasks = generateShuffleMasks();
+
+	__attribute__((target("pclmul,ssse3"))) inline __m128i shuffleLane(__m128i lanes, size_t laneNum) {
+		return _mm_shuffle_epi8( lanes, _mm_load_si128(reinterpret_cast<__m128i const *>(LaneShuffleMasks.masks[laneNum])) );
+	}
+
+	/**
+	 * Loads 8 words and arranges them as polynomial  word[0]*x^56 + word[1]*x^48 + .. + word[7].
+	 * Words n and n+4 are 32 bits apart; interleaving both half blocks yields four 64 bit lanes (word[n]*x^32 + word[n+4]),
+	 * which are subsequently moved to their byte offsets (3-n).
+	 */
+	__attribute__((target("pclmul,ssse3"))) inline __m128i loadBlock(uint32_t const words[]) {
+		const __m128i lower = _mm_loadu_si128( reinterpret_cast<__m128i const *>(&words[0]) );
+		const __m128i upper = _mm_loadu_si128( reinterpret_cast<__m128i const *>(&words[4]) );
+		const __m128i lanes01 = _mm_unpacklo_epi32( upper, lower );
+		const __m128i lanes23 = _mm_unpackhi_epi32( upper, lower );
+		return _mm_xor_si128( _mm_xor_si128(shuffleLane(lanes01, 0), shuffleLane(lanes01, 1)), _mm_xor_si128(shuffleLane(lanes23, 2), shuffleLane(lanes23, 3)) );
+	}
+
+	/**
+	 * Continues the calculation from 'remainder' over nWords (multiple of WordsPerBlock*AccumulatorCount, at least
+	 * MinimumWordCount) and returns the new remainder.
+	 */
+	__attribute__((target("pclmul,ssse3"))) uint32_t updateClmul(uint32_t remainder, uint32_t const words[], size_t nWords) {
+		constexpr size_t WordsPerIteration = WordsPerBlock * AccumulatorCount;
+		constexpr uint_fast16_t BlockDistance = 8 * WordsPerBlock;
+
+		// The start remainder belongs to the first word, which is located at x^56 within the first block.
+		__m128i accumulators[AccumulatorCount];
+		for (size_t i = 0; i<AccumulatorCount; i++)
+			accumulators[i] = loadBlock( &words[i * WordsPerBlock] );
+		accumulators[0] = _mm_xor_si128( accumulators[0], _mm_slli_si128(_mm_cvtsi32_si128(static_cast<int>(remainder)), 7) );
+
+		for (size_t wordNum = WordsPerIteration; wordNum < nWords; wordNum += WordsPerIteration) {
+			accumulators[0] = _mm_xor_si128( fold<BlockDistance*AccumulatorCount>(accumulators[0]), loadBlock(&words[wordNum]) );
+			accumulators[1] = _mm_xor_si128( fold<BlockDistance*AccumulatorCount>(accumulators[1]), loadBlock(&words[wordNum + WordsPerBlock]) );
+			accumulators[2] = _mm_xor_si128( fold<BlockDistance*AccumulatorCount>(accumulators[2]), loadBlock(&words[wordNum + 2*WordsPerBlock]) );
+			accumulators[3] = _mm_xor_si128( fold<BlockDistance*AccumulatorCount>(accumulators[3]), loadBlock(&words[wordNum + 3*WordsPerBlock]) );
+		}
+
+		// Combine the accumulators
+		__m128i sum = accumulators[3];
+		sum = _mm_xor_si128( sum, fold<BlockDistance>(accumulators[2]) );
+		sum = _mm_xor_si128( sum, fold<2*BlockDistance>(accumulators[1]) );
+		sum = _mm_xor_si128( sum, fold<3*BlockDistance>(accumulators[0]) );
+
+		// Reduce (sum * x^8) mod P, byte by byte, starting with the most significant ones
+		alignas(16) uint8_t bytes[16];
+		_mm_store_si128( reinterpret_cast<__m128i *>(bytes), sum );
+		remainder = (static_cast<uint32_t>(bytes[15]) << 24) | (static_cast<uint32_t>(bytes[14]) << 16) | (static_cast<uint32_t>(bytes[13]) << 8) | bytes[12];
+		for (int byteNum = 11; byteNum >= 0; byteNum--)
+			remainder = shiftByte(remainder) ^ bytes[byteNum];
+		return shiftByte(remainder);
+	}
+
+	bool isClmulSupported() {
+		static const bool IsSupported = __builtin_cpu_supports("pclmul") && __builtin_cpu_supports("ssse3");
+		return IsSupported;
+	}
+
+} /* anonymous namespace */
+#endif /* CRC32_CLMUL_AVAILABLE */
+
+
+
+uint32_t calculateCrc32_clmul(uint32_t const words[], size_t nWords) {
+	#ifdef CRC32_CLMUL_AVAILABLE
+		if ( nWords >= MinimumWordCount  &&  isClmulSupported() ) {
+			const size_t nClmulWords = nWords - (nWords % (WordsPerBlock * AccumulatorCount));
+			Crc32Context context;
+			context.remainder = updateClmul( CRC32_STARTVALUE, words, nClmulWords );
+			context.pendingByteCount = 0;
+			updateCrc32( &context, &words[nClmulWords], (nWords - nClmulWords) * sizeof(uint32_t) );
+			return finalizeCrc32( &context );
+		}
+	#endif
+	return calculateCrc32_sliceBy8( words, nWords );
+}
@@ -0,0 +1,43 @@
+/*
+ * crc8.cpp
+ *
+ *  Created on: 29.11.2017
+ *      Author: Robert Voelckner
+ *
+ *  Description:
+ *    This module provides functionality to calculate CRC-8.
+ *
+ *    Provides the C interface of the generic CRC engine's CRC-8/NRSC-5 variant (@see Crc.h), which has exactly the
+ *    parameters stated in crc8.h.
+ */
+#include "crc8.h"
+#include "Crc.h"
+
+#include <stdint-gcc.h>
+#include <stddef.h>
+
+
+static_assert( Util::Crc8_Nrsc5::calculate("123456789", 9) == 0xF7, "Crc8_Nrsc5 must match CRC8_POLYNOMIAL and CRC8_STARTVALUE!" );
+
+
+#ifdef __GNUC__
+	__attribute__((weak)) /*Allows to override the following CRC-8 implmentation by the application*/
+#endif
+uint8_t calculateCrc8(uint8_t const bytes[], size_t nbytes) {
+	return Util::Crc8_Nrsc5::calculate(bytes, nbytes);
+}
+
+
+void initializeCrc8(Crc8Context *context) {
+	context->remainder = Util::Crc8_Nrsc5().value();
+}
+
+
+void updateCrc8(Crc8Context *context, void const *bytes, size_t nbytes) {
+	context->remainder = Util::Crc8_Nrsc5(context->remainder).update(bytes, nbytes).value();
+}
+
+
+uint8_t finalizeCrc8(Crc8Context const *context) {
+	return context->remainder;
+}
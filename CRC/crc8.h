@@ -35,6 +35,36 @@ extern "C" {
 	 */
 	extern uint8_t calculateCrc8(uint8_t const bytes[], size_t nbytes);
 
+	/// Context of an incremental CRC-8 calculation. Must be initialized using @see initializeCrc8 before usage.
+	typedef struct {
+		uint8_t remainder;
+	} Crc8Context;
+
+	/**
+	 * Initializes a context for incremental CRC-8 calculation.
+	 *
+	 * @param context 	..	The context to be initialized.
+	 */
+	extern void initializeCrc8(Crc8Context *context);
+
+	/**
+	 * Feeds an arbitrary amount of data bytes into an incremental CRC-8 calculation. The data may be split
+	 * into chunks of any size, e.g. single bytes as they are dequeued from a receive buffer.
+	 *
+	 * @param context 	..	The context, initialized by @see initializeCrc8
+	 * @param bytes   	..	Data bytes. May be NULL if nbytes is 0.
+	 * @param nbytes  	..	Number of data bytes
+	 */
+	extern void updateCrc8(Crc8Context *context, void const *bytes, size_t nbytes);
+
+	/**
+	 * Returns the CRC-8 over all data bytes fed so far. The context remains unchanged, so further data may be fed afterwards.
+	 *
+	 * @param context 	..	The context, initialized by @see initializeCrc8
+	 * @return         	..	Returns the CRC-8
+	 */
+	extern uint8_t finalizeCrc8(Crc8Context const *context);
+
 
 #ifdef __cplusplus
 } /* extern "C" */
@@ -5,144 +5,297 @@
  *      Author: Robert Voelckner
  *
  *  Description:
- *    This class contains a circular buffer for POD value types.
+ *    This class contains a circular buffer. Elements are constructed in place within uninitialized storage and
+ *    are moved out upon dequeuing, so that non-POD types are possible, too.
  *
  *    Further information:
  *      - no usage of dynamic memory,
- *      - in order to prevent race conditions, the use of Mutexes is possible.
+ *      - trivially copyable types (e.g. POD) are copied using plain copies or memcpy,
+ *      - in order to prevent race conditions, the use of Mutexes is possible. Several operations may share one
+ *        locked section by means of @see lock(),
+ *      - any capacity is possible; the narrowest sufficient index type gets chosen automatically,
+ *      - if the capacity is a power of two, read and write positions are free-running and get masked when
+ *        accessing the array. Otherwise they wrap around at twice the capacity, which allows to tell 'full'
+ *        and 'empty' apart without an element counter,
+ *      - optionally, statistics about occupancy and lost elements are recorded. @see FifoStatistics.h
  */
 #ifndef APPLICATION_USER_FIFO_FIFO_H_
 #define APPLICATION_USER_FIFO_FIFO_H_
 
 
+#include <stdint-gcc.h>
+#include <stddef.h>
+#include <string.h>
 #include <array>
+#include <iterator>
+#include <new>
 #include <type_traits>
+#include <utility>
 
-#include <Mutex/MutexBase.h>
+#include <Mutex/LockPolicy.h>
 #include <Mutex/NoMutex.h>
+#include "FifoStatistics.h"
 
 namespace Util {
 	namespace Lists {
 		namespace StaticMemory {
 
-			template <typename T, bool OverwriteOldestElementIfFull = false, uint_fast8_t TArraySize = 15, typename MutexImpl = Util::Mutex::NoMutex>
-			class Fifo {
-				static_assert( std::is_constructible<MutexImpl>::value, "The given Mutex type must be constructible using the non-arguments-constructor!" );
-				static_assert( std::is_pod<T>::value, "T must be Plain-Old-Data!" );
+			template <typename T, bool OverwriteOldestElementIfFull = false, size_t TArraySize = 15, typename MutexImpl = Util::Mutex::NoMutex, typename StatisticsImpl = NoFifoStatistics>
+			class Fifo : private StatisticsImpl::template Recorder<TArraySize> {
+				static_assert( Util::Mutex::IsLockPolicy<MutexImpl>::value, "The given Mutex type must provide static lock(), unlock() and try_lock()! @see Mutex/LockPolicy.h" );
+				static_assert( TArraySize > 0  &&  TArraySize <= SIZE_MAX / 2, "Invalid TArraySize!" );
+
+				private:
+					static constexpr bool   IsPowerOfTwo = (TArraySize & (TArraySize - 1)) == 0;
+					static constexpr size_t MaxPosition  = IsPowerOfTwo  ?  TArraySize  :  2 * TArraySize - 1;
 
 				public:
+					/// Narrowest unsigned type capable of holding the read and write positions. Used for element counts as well.
+					using size_type = typename std::conditional<(MaxPosition <= UINT8_MAX),  uint8_t,
+									  typename std::conditional<(MaxPosition <= UINT16_MAX), uint16_t,
+									  typename std::conditional<(MaxPosition <= UINT32_MAX), uint32_t,
+																							 size_t>::type>::type>::type;
+
+					/// Statistics recorded according to StatisticsImpl. Empty for NoFifoStatistics.
+					using statistics_type = typename StatisticsImpl::template Recorder<TArraySize>;
+
+					/**
+					 * Random access iterator over the present elements, starting with the oldest one. Usable with range-for
+					 * and <algorithm>. Each access is O(1).
+					 *
+					 * @remark Iterators don't lock the Mutex. Applying or removing elements invalidates them.
+					 */
+					template <typename TElement>
+					class IteratorTemplate {
+							template <typename> friend class IteratorTemplate;
+							friend class Fifo;
+
+						public:
+							using iterator_category = std::random_access_iterator_tag;
+							using value_type        = typename std::remove_const<TElement>::type;
+							using difference_type   = ptrdiff_t;
+							using pointer           = TElement*;
+							using reference         = TElement&;
+
+							IteratorTemplate() : m_array(nullptr), m_readPosition(0), m_offset(0) {}
+
+							/// Allows to convert an iterator into a const_iterator.
+							template <typename TOther, typename std::enable_if<std::is_convertible<TOther*, TElement*>::value>::type* = nullptr>
+							IteratorTemplate( const IteratorTemplate<TOther>& other ) : m_array(other.m_array), m_readPosition(other.m_readPosition), m_offset(other.m_offset) {}
+
+							reference operator*() const                               { return m_array[arrayIndex( advance(m_readPosition, static_cast<size_t>(m_offset)) )]; }
+							pointer operator->() const                                { return &**this; }
+							reference operator[]( difference_type distance ) const    { return *(*this + distance); }
+
+							IteratorTemplate& operator++()                            { m_offset++;  return *this; }
+							IteratorTemplate& operator--()                            { m_offset--;  return *this; }
+							IteratorTemplate operator++(int)                          { IteratorTemplate previous = *this;  m_offset++;  return previous; }
+							IteratorTemplate operator--(int)                          { IteratorTemplate previous = *this;  m_offset--;  return previous; }
+							IteratorTemplate& operator+=( difference_type distance )  { m_offset += distance;  return *this; }
+							IteratorTemplate& operator-=( difference_type distance )  { m_offset -= distance;  return *this; }
+
+							friend IteratorTemplate operator+( IteratorTemplate iterator, difference_type distance )  { return iterator += distance; }
+							friend IteratorTemplate operator+( difference_type distance, IteratorTemplate iterator )  { return iterator += distance; }
+							friend IteratorTemplate operator-( IteratorTemplate iterator, difference_type distance )  { return iterator -= distance; }
+							friend difference_type operator-( const IteratorTemplate& a, const IteratorTemplate& b )  { return a.m_offset - b.m_offset; }
+
+							friend bool operator==( const IteratorTemplate& a, const IteratorTemplate& b )  { return a.m_offset == b.m_offset; }
+							friend bool operator!=( const IteratorTemplate& a, const IteratorTemplate& b )  { return a.m_offset != b.m_offset; }
+							friend bool operator< ( const IteratorTemplate& a, const IteratorTemplate& b )  { return a.m_offset <  b.m_offset; }
+							friend bool operator> ( const IteratorTemplate& a, const IteratorTemplate& b )  { return a.m_offset >  b.m_offset; }
+							friend bool operator<=( const IteratorTemplate& a, const IteratorTemplate& b )  { return a.m_offset <= b.m_offset; }
+							friend bool operator>=( const IteratorTemplate& a, const IteratorTemplate& b )  { return a.m_offset >= b.m_offset; }
+
+						private:
+							IteratorTemplate( TElement *array, size_type readPosition, difference_type offset ) : m_array(array), m_readPosition(readPosition), m_offset(offset) {}
+
+							TElement       *m_array;
+							size_type       m_readPosition;  ///< Read position at the time the iterator was created.
+							difference_type m_offset;        ///< Number of elements from the oldest one on.
+					};
+
+					using iterator       = IteratorTemplate<T>;
+					using const_iterator = IteratorTemplate<const T>;
+
+					/**
+					 * Guard obtained by @see lock(). The Mutex stays locked as long as the guard exists, and its operations
+					 * access the circular buffer without locking again. Thus, several operations cost one locked section only:
+					 *
+					 *   {
+					 *     auto locked = fifo.lock();
+					 *     if ( locked.peek()  &&  isComplete(*locked.peek()) )  locked.dequeue( &message );
+					 *   }  // --> Unlocked here
+					 *
+					 * @remark While a guard exists, the operations of the Fifo itself must not be called by the same context,
+					 *         unless the Mutex allows nesting. Keep the scope short; e.g. ArmInterruptPreventionMutex disables
+					 *         interrupts meanwhile.
+					 */
+					class Locked {
+							friend class Fifo;
+
+						public:
+							/// Takes over the locked Mutex, so that it gets unlocked only once.
+							Locked( Locked &&other ) : m_fifo(other.m_fifo) {
+								other.m_fifo = nullptr;
+							}
+
+							Locked( const Locked& ) = delete;
+							Locked& operator=( const Locked& ) = delete;
+							Locked& operator=( Locked&& ) = delete;
+
+							~Locked() {
+								if ( m_fifo )  MutexImpl::unlock();
+							}
+
+							inline bool isEmpty() const                   { return m_fifo->isEmpty(); }
+							inline bool isFull() const                    { return m_fifo->isFull(); }
+							inline size_type size() const                 { return m_fifo->size(); }
+							inline size_type Count() const                { return m_fifo->Count(); }
+							inline size_type freeElementCount() const     { return m_fifo->freeElementCount(); }
+
+							void clear()                                  { m_fifo->clearUnlocked(); }
+
+							template <typename... TArguments>
+							bool emplace( TArguments&&... arguments )     { return m_fifo->emplaceUnlocked( std::forward<TArguments>(arguments)... ); }
+							bool enqueue( const T& copyFromElement )      { return m_fifo->emplaceUnlocked( copyFromElement ); }
+							bool enqueue( T&& moveFromElement )           { return m_fifo->emplaceUnlocked( std::move(moveFromElement) ); }
+							bool dequeue( T *copyDestination )            { return m_fifo->dequeueUnlocked( copyDestination ); }
+							void dequeue()                                { m_fifo->dequeueUnlocked( nullptr ); }
+
+							size_t enqueueBulk( const T copyFromElements[], size_t elementCount )         { return m_fifo->enqueueBulkUnlocked( copyFromElements, elementCount ); }
+							size_t dequeueBulk( T copyDestination[], size_t maxElementCount )             { return m_fifo->dequeueBulkUnlocked( copyDestination, maxElementCount ); }
+
+							T* reserveWrite( size_t elementCount, size_type *reservedCount = nullptr )    { return m_fifo->reserveWriteUnlocked( elementCount, reservedCount ); }
+							void commitWrite( size_t elementCount )                                       { m_fifo->commitWriteUnlocked( elementCount ); }
+							T* peekRead( size_type *elementCount = nullptr )                              { return m_fifo->peekReadUnlocked( elementCount ); }
+							size_t release( size_t elementCount )                                         { return m_fifo->dequeueBulkUnlocked( nullptr, elementCount ); }
+
+							T* peek()                                     { return m_fifo->peekUnlocked(); }
+							T* peek( size_type index )                    { return m_fifo->peekUnlocked( index ); }
+							T& operator[]( size_type index )              { return (*m_fifo)[index]; }
+
+							iterator begin()                              { return m_fifo->begin(); }
+							iterator end()                                { return m_fifo->end(); }
+
+							const statistics_type& statistics() const     { return *m_fifo; }
+
+						private:
+							explicit Locked( Fifo &fifo ) : m_fifo(&fifo) {
+								MutexImpl::lock();
+							}
+
+							Fifo *m_fifo;  ///< NULL once moved from.
+					};
 
 					Fifo() {
-						m_nextReadIndex = m_nextWriteIndex = m_elementCount = 0;
+						m_readPosition = m_writePosition = 0;
+					}
+
+					/**
+					 * Copy constructor. Copy-constructs the present elements, and takes over the statistics.
+					 */
+					Fifo( const Fifo& other ) : statistics_type() {
+						Util::Mutex::LockGuard<MutexImpl> _mutex;  // Locks the following code section; upon destruction the section gets unlocked automatically.
+						copyFrom( other );
+					}
+
+					Fifo& operator=( const Fifo& other ) {
+						if ( this == &other )  return *this;
+						Util::Mutex::LockGuard<MutexImpl> _mutex;  // Locks the following code section; upon destruction the section gets unlocked automatically.
+						destroyAllElements();
+						copyFrom( other );
+						return *this;
 					}
 
 					~Fifo(void) {
-						// Nothing happens here..
+						destroyAllElements();
 					}
 
 					/**
 					 * Returns if the circular buffer is empty.
 					 */
 					inline bool isEmpty(void) const {
-						if ( m_elementCount == 0 )  return true;
-						return false;
+						return m_readPosition == m_writePosition;
 					}
 
 					/**
 					 * Returns if the circular buffer is full.
 					 */
 					inline bool isFull(void) const {
-						if ( m_elementCount >= TArraySize ) return true;
-						return false;
+						return Count() >= TArraySize;
 					}
 
 					/**
 					 * Returns the maximum size of the circular buffer.
 					 */
-					inline uint_fast8_t size() const {
+					inline size_type size() const {
 						return TArraySize;
 					}
 
 					/**
 					 * Returns the number of present elements.
 					 */
-					inline uint_fast8_t Count() const {
-						return m_elementCount;
+					inline size_type Count() const {
+						return countBetween( m_readPosition, m_writePosition );
 					}
 
 					/**
 					 * Returns the number of free element slots.
 					 */
-					inline uint_fast8_t freeElementCount() const {
-						return (TArraySize - m_elementCount);
+					inline size_type freeElementCount() const {
+						return static_cast<size_type>( TArraySize - Count() );
 					}
 
 					/**
 					 * Clears the circular buffer.
 					 */
 					void clear(void) {
-						MutexImpl _mutex;  // Locks the following code section; upon destruction the section gets unlocked automatically.
-						m_nextReadIndex = m_nextWriteIndex = m_elementCount = 0;
+						Util::Mutex::LockGuard<MutexImpl> _mutex;  // Locks the following code section; upon destruction the section gets unlocked automatically.
+						clearUnlocked();
 					}
 
 					/**
-					 * Applies (copies) one element to the circular buffer.
+					 * Constructs one element in place within the circular buffer.
 					 *
-					 * @remark In case the circular buffer is full, the element won't be copied.
+					 * @remark In case the circular buffer is full, either no element will be constructed or the oldest
+					 *         element will be overwritten, depending on OverwriteOldestElementIfFull.
 					 *
-					 * @param copyFromElement 	..	The element that will be applied.
+					 * @param arguments       	..	Arguments which are passed to the constructor of T.
 					 * @return                	..	Returns if the operation was successful.
 					 */
-					template <bool Overwrite = OverwriteOldestElementIfFull, typename std::enable_if<!Overwrite>::type* = nullptr>  /* Spezialisierung fr "OverwriteOldestElementIfFull = false" */
-					bool enqueue( const T& copyFromElement ) {
-						MutexImpl _mutex;  // Locks the following code section; upon destruction the section gets unlocked automatically.
-						if ( isFull() )  {
-							return false;
-						}
-						m_elementArray[m_nextWriteIndex] = copyFromElement;
-						m_nextWriteIndex++;     if ( m_nextWriteIndex >= TArraySize )  m_nextWriteIndex = 0;
-						m_elementCount++;
-						return true;
+					template <typename... TArguments>
+					bool emplace( TArguments&&... arguments ) {
+						Util::Mutex::LockGuard<MutexImpl> _mutex;  // Locks the following code section; upon destruction the section gets unlocked automatically.
+						return emplaceUnlocked( std::forward<TArguments>(arguments)... );
 					}
 
 					/**
-					 * Applies (copies) one element to the circular buffer.
+					 * Applies (copies or moves) one element to the circular buffer.
 					 *
-					 * @remark In case the circular buffer is full, the oldest element will be overwritten.
+					 * @remark In case the circular buffer is full, either the element won't be applied or the oldest
+					 *         element will be overwritten, depending on OverwriteOldestElementIfFull.
 					 *
 					 * @param copyFromElement 	..	The element that will be applied.
 					 * @return                	..	Returns if the operation was successful.
 					 */
-					template <bool Overwrite = OverwriteOldestElementIfFull, typename std::enable_if<Overwrite>::type* = nullptr>  /* Spezialisierung fr "OverwriteOldestElementIfFull = true" */
 					bool enqueue( const T& copyFromElement ) {
-						MutexImpl _mutex;  // Locks the following code section; upon destruction the section gets unlocked automatically.
-						m_elementArray[m_nextWriteIndex] = copyFromElement;
-						m_nextWriteIndex++;     if ( m_nextWriteIndex >= TArraySize )  m_nextWriteIndex = 0;
-						if ( !isFull() ) {
-							m_elementCount++;
-						} else /*if ( isFull() )*/ {
-							m_nextReadIndex++;  if ( m_nextReadIndex >= TArraySize )  m_nextReadIndex = 0;
-						}
-						return true;
+						return emplace( copyFromElement );
+					}
+					bool enqueue( T&& moveFromElement ) {
+						return emplace( std::move(moveFromElement) );
 					}
 
 					/**
-					 * Fetches the oldest element and removes it from circular buffer.
+					 * Fetches (moves out) the oldest element and removes it from circular buffer.
 					 *
-					 * @param copyDestination 	..	Holds the destination the element should be copied to. May be NULL!
+					 * @param copyDestination 	..	Holds the destination the element should be moved to. May be NULL!
 					 * @return                	..	Returns if the operation was successful.
 					 *                    	      	  true:  The operation was successful.
 					 *                    	      	  false: The circular buffer was empty; operation not successful.
 					 */
 					bool dequeue( T *copyDestination ) {
-						MutexImpl _mutex;  // Locks the following code section; upon destruction the section gets unlocked automatically.
-						if ( isEmpty() )  {
-							return false;
-						}
-						if (copyDestination)  *copyDestination = m_elementArray[m_nextReadIndex];
-						m_nextReadIndex++;  if ( m_nextReadIndex >= TArraySize )  m_nextReadIndex = 0;
-						m_elementCount--;
-						return true;
+						Util::Mutex::LockGuard<MutexImpl> _mutex;  // Locks the following code section; upon destruction the section gets unlocked automatically.
+						return dequeueUnlocked( copyDestination );
 					}
 
 					/**
@@ -152,18 +305,97 @@ namespace Util {
 						dequeue(nullptr);
 					}
 
+					/**
+					 * Applies (copies) several elements to the circular buffer. The Mutex is locked only once, and the
+					 * elements are copied in at most two contiguous segments.
+					 *
+					 * @remark If OverwriteOldestElementIfFull is false, only as many elements as there are free slots get copied.
+					 *         Otherwise all elements get applied, overwriting the oldest ones; if more than TArraySize elements
+					 *         are given, only the last TArraySize ones remain.
+					 *
+					 * @param copyFromElements	..	The elements that will be applied. May be NULL if elementCount is 0.
+					 * @param elementCount    	..	Number of elements to apply. May exceed the capacity.
+					 * @return                	..	Returns the number of elements that were put into the circular buffer.
+					 */
+					size_t enqueueBulk( const T copyFromElements[], size_t elementCount ) {
+						Util::Mutex::LockGuard<MutexImpl> _mutex;  // Locks the following code section; upon destruction the section gets unlocked automatically.
+						return enqueueBulkUnlocked( copyFromElements, elementCount );
+					}
+
+					/**
+					 * Fetches (moves out) several of the oldest elements and removes them from circular buffer. The Mutex is
+					 * locked only once, and the elements are copied in at most two contiguous segments.
+					 *
+					 * @param copyDestination 	..	Holds the destination the elements should be copied to. May be NULL, then the elements are discarded.
+					 * @param maxElementCount 	..	Maximum number of elements to fetch, i.e. capacity of copyDestination. May exceed the capacity.
+					 * @return                	..	Returns the number of elements that were fetched.
+					 */
+					size_t dequeueBulk( T copyDestination[], size_t maxElementCount ) {
+						Util::Mutex::LockGuard<MutexImpl> _mutex;  // Locks the following code section; upon destruction the section gets unlocked automatically.
+						return dequeueBulkUnlocked( copyDestination, maxElementCount );
+					}
+
+					/**
+					 * Reserves a contiguous region of free slots, which may be written directly (e.g. by DMA). The elements
+					 * become part of the circular buffer upon @see commitWrite().
+					 *
+					 * @remark The region never wraps around the end of the array, thus fewer elements than requested may be
+					 *         granted. Even in overwrite mode, only free slots are reserved. Until the region is committed,
+					 *         no other element must be applied to the circular buffer. Only available for trivially copyable
+					 *         types, since the slots are handed out unconstructed.
+					 *
+					 * @param elementCount    	..	Number of requested slots.
+					 * @param reservedCount   	..	Receives the number of granted slots. May be NULL.
+					 * @return                	..	Pointer to the first reserved slot. Will be NULL if no slot is free.
+					 */
+					T* reserveWrite( size_t elementCount, size_type *reservedCount = nullptr ) {
+						Util::Mutex::LockGuard<MutexImpl> _mutex;  // Locks the following code section; upon destruction the section gets unlocked automatically.
+						return reserveWriteUnlocked( elementCount, reservedCount );
+					}
+
+					/**
+					 * Appends the first elements of the region obtained by @see reserveWrite() to the circular buffer.
+					 *
+					 * @param elementCount    	..	Number of written elements. Must not exceed the number of reserved slots.
+					 */
+					void commitWrite( size_t elementCount ) {
+						Util::Mutex::LockGuard<MutexImpl> _mutex;  // Locks the following code section; upon destruction the section gets unlocked automatically.
+						commitWriteUnlocked( elementCount );
+					}
+
+					/**
+					 * Returns the contiguous region starting at the oldest element, so that elements may be processed in place.
+					 * Processed elements get removed using @see release().
+					 *
+					 * @remark The region never wraps around the end of the array; the remaining elements are returned by the
+					 *         next call after releasing. In overwrite mode, applying further elements might overwrite the region.
+					 *
+					 * @param elementCount    	..	Receives the number of elements within the region. May be NULL.
+					 * @return                	..	Pointer to the oldest element. Will be NULL if the circular buffer is empty.
+					 */
+					T* peekRead( size_type *elementCount = nullptr ) {
+						Util::Mutex::LockGuard<MutexImpl> _mutex;  // Locks the following code section; upon destruction the section gets unlocked automatically.
+						return peekReadUnlocked( elementCount );
+					}
+
+					/**
+					 * Removes the oldest elements, e.g. after processing them via @see peekRead().
+					 *
+					 * @param elementCount    	..	Number of elements to remove.
+					 * @return                	..	Returns the number of removed elements.
+					 */
+					size_t release( size_t elementCount ) {
+						return dequeueBulk( nullptr, elementCount );
+					}
+
 					/**
 					 * Returns a pointer to the oldest element, without removing it from buffer.
 					 *
 					 * @return	..	Pointer to the oldest element. Will be NULL if the circular buffer is empty.
 					 */
 					T* peek() {
-						MutexImpl _mutex;  // Locks the following code section; upon destruction the section gets unlocked automatically.
-						if ( isEmpty() )  {
-							return 0;
-						}
-						T* retPtr = &m_elementArray[m_nextReadIndex];
-						return retPtr;
+						Util::Mutex::LockGuard<MutexImpl> _mutex;  // Locks the following code section; upon destruction the section gets unlocked automatically.
+						return peekUnlocked();
 					}
 
 					/**
@@ -172,26 +404,314 @@ namespace Util {
 					 * @param index   	..	Index of the desired element. Index 0 corresponds to the pointer returned by @see peek().
 					 * @return        	..	Pointer to the element. Will be NULL if there is no element at the given index.
 					 */
-					T* peek( uint_fast8_t index ) {
-						MutexImpl _mutex;  // Locks the following code section; upon destruction the section gets unlocked automatically.
-						if ( index >= m_elementCount )  {
+					T* peek( size_type index ) {
+						Util::Mutex::LockGuard<MutexImpl> _mutex;  // Locks the following code section; upon destruction the section gets unlocked automatically.
+						return peekUnlocked( index );
+					}
+
+					/**
+					 * Returns a certain element, without removing it from buffer. Neither locks the Mutex nor checks the index.
+					 *
+					 * @param index   	..	Index of the desired element. Index 0 corresponds to the oldest element.
+					 */
+					T& operator[]( size_type index ) {
+						return elementArray()[arrayIndex( advance(m_readPosition, index) )];
+					}
+					const T& operator[]( size_type index ) const {
+						return elementArray()[arrayIndex( advance(m_readPosition, index) )];
+					}
+
+					/**
+					 * Iterators over the present elements, starting with the oldest one. They don't lock the Mutex; in order to
+					 * pass all elements within one locked section, use @see forEach().
+					 */
+					iterator begin()              { return iterator( elementArray(), m_readPosition, 0 ); }
+					iterator end()                { return iterator( elementArray(), m_readPosition, Count() ); }
+					const_iterator begin() const  { return const_iterator( elementArray(), m_readPosition, 0 ); }
+					const_iterator end() const    { return const_iterator( elementArray(), m_readPosition, Count() ); }
+					const_iterator cbegin() const { return begin(); }
+					const_iterator cend() const   { return end(); }
+
+					/**
+					 * Calls a function for each present element, starting with the oldest one. The Mutex is locked only once
+					 * for the whole pass.
+					 *
+					 * @param function 	..	Callable taking T& (or const T& for const instances).
+					 */
+					template <typename TFunction>
+					void forEach( TFunction function ) {
+						Util::Mutex::LockGuard<MutexImpl> _mutex;  // Locks the following code section; upon destruction the section gets unlocked automatically.
+						for (T &element : *this)  function( element );
+					}
+					template <typename TFunction>
+					void forEach( TFunction function ) const {
+						Util::Mutex::LockGuard<MutexImpl> _mutex;  // Locks the following code section; upon destruction the section gets unlocked automatically.
+						for (const T &element : *this)  function( element );
+					}
+
+					/**
+					 * Locks the Mutex and returns a guard, whose operations don't lock it again. Upon destruction of the
+					 * guard, the Mutex gets unlocked. @see Locked
+					 */
+					Locked lock() {
+						return Locked( *this );
+					}
+
+					/**
+					 * Returns the statistics recorded so far. @see FifoStatistics.h
+					 *
+					 * @remark Doesn't lock the Mutex. If the Fifo is accessed concurrently, the values may stem from different
+					 *         points in time. The 32 bit counters are consistent on their own; the residence times are not,
+					 *         as their sum is 64 bits wide and may be torn by an update on a 32 bit CPU. For consistent
+					 *         values, read them while the Fifo is locked:
+					 *
+					 *           const auto averageTime = fifo.lock().statistics().averageResidenceTime();
+					 */
+					inline const statistics_type& statistics() const {
+						return *this;
+					}
+
+					/**
+					 * Resets all statistics, e.g. after a startup phase or once they were reported.
+					 */
+					void resetStatistics() {
+						Util::Mutex::LockGuard<MutexImpl> _mutex;  // Locks the following code section; upon destruction the section gets unlocked automatically.
+						this->reset();
+					}
+
+
+				private:
+					using storage_t = typename std::aligned_storage<sizeof(T), alignof(T)>::type;
+
+					inline T* elementArray() {
+						return reinterpret_cast<T*>( m_elementStorage.data() );
+					}
+					inline const T* elementArray() const {
+						return reinterpret_cast<const T*>( m_elementStorage.data() );
+					}
+
+					// Implementations of the public operations, without locking the Mutex. Also used by @see Locked.
+
+					void clearUnlocked(void) {
+						destroyAllElements();
+						m_readPosition = m_writePosition = 0;
+					}
+
+					template <typename... TArguments, bool Overwrite = OverwriteOldestElementIfFull, typename std::enable_if<!Overwrite>::type* = nullptr>  /* Spezialisierung fr "OverwriteOldestElementIfFull = false" */
+					bool emplaceUnlocked( TArguments&&... arguments ) {
+						const size_type writePosition = m_writePosition;
+						const size_type count = countBetween( m_readPosition, writePosition );
+						if ( count >= TArraySize )  {
+							this->recordRejection( 1 );
+							return false;
+						}
+						new (&elementArray()[arrayIndex(writePosition)]) T( std::forward<TArguments>(arguments)... );
+						m_writePosition = advance( writePosition, 1 );
+						this->recordEnqueue( arrayIndex(writePosition), 1, count + 1u );
+						return true;
+					}
+
+					template <typename... TArguments, bool Overwrite = OverwriteOldestElementIfFull, typename std::enable_if<Overwrite>::type* = nullptr>  /* Spezialisierung fr "OverwriteOldestElementIfFull = true" */
+					bool emplaceUnlocked( TArguments&&... arguments ) {
+						const size_type readPosition = m_readPosition, writePosition = m_writePosition;
+						const bool isFull = countBetween(readPosition, writePosition) >= TArraySize;
+						if ( isFull ) {
+							// The new element takes the oldest one's slot. It is built before destroying the oldest one, as the
+							// arguments may refer to it (e.g. enqueue( *peek() )).
+							T newElement( std::forward<TArguments>(arguments)... );
+							destroyElements( readPosition, 1 );
+							m_readPosition = advance( readPosition, 1 );
+							this->recordOverwrite( 1 );
+							new (&elementArray()[arrayIndex(writePosition)]) T( std::move(newElement) );
+						} else {
+							new (&elementArray()[arrayIndex(writePosition)]) T( std::forward<TArguments>(arguments)... );
+						}
+						m_writePosition = advance( writePosition, 1 );
+						this->recordEnqueue( arrayIndex(writePosition), 1, isFull  ?  TArraySize  :  countBetween(readPosition, writePosition) + 1u );
+						return true;
+					}
+
+					bool dequeueUnlocked( T *copyDestination ) {
+						const size_type readPosition = m_readPosition;
+						if ( readPosition == m_writePosition )  {
+							return false;
+						}
+						T &element = elementArray()[arrayIndex(readPosition)];
+						if (copyDestination)  *copyDestination = std::move( element );
+						element.~T();
+						m_readPosition = advance( readPosition, 1 );
+						this->recordDequeue( arrayIndex(readPosition), 1 );
+						return true;
+					}
+
+					size_t enqueueBulkUnlocked( const T copyFromElements[], size_t requestedCount ) {
+						const size_type freeCount = freeElementCount();
+						if ( OverwriteOldestElementIfFull ) {
+							if ( requestedCount > TArraySize ) {
+								this->recordOverwrite( requestedCount - TArraySize );  // --> These never make it into the buffer
+								copyFromElements += requestedCount - TArraySize;
+								requestedCount = TArraySize;
+							}
+						} else if ( requestedCount > freeCount ) {
+							this->recordRejection( requestedCount - freeCount );
+							requestedCount = freeCount;
+						}
+						const size_type elementCount = static_cast<size_type>( requestedCount );  // --> Clamped to TArraySize above
+						if ( elementCount == 0 )  return 0;
+
+						const bool overwritesOldestElements = elementCount > freeCount;
+						if ( overwritesOldestElements ) {
+							destroyElements( m_readPosition, static_cast<size_type>(elementCount - freeCount) );
+							this->recordOverwrite( elementCount - freeCount );
+						}
+						const size_type writeIndex = arrayIndex( m_writePosition );
+						const size_type firstSegmentCount = (elementCount < TArraySize - writeIndex)  ?  elementCount  :  static_cast<size_type>(TArraySize - writeIndex);
+						constructCopies( &elementArray()[writeIndex], copyFromElements, firstSegmentCount );
+						constructCopies( &elementArray()[0], copyFromElements + firstSegmentCount, static_cast<size_type>(elementCount - firstSegmentCount) );
+						m_writePosition = advance( m_writePosition, elementCount );
+						if ( overwritesOldestElements ) {
+							// The read position is TArraySize elements behind. Without power of two, positions wrap at 2*TArraySize, so going forward by TArraySize is the same.
+							m_readPosition = IsPowerOfTwo  ?  static_cast<size_type>( m_writePosition - TArraySize )  :  advance( m_writePosition, TArraySize );
+						}
+						this->recordEnqueue( writeIndex, elementCount, overwritesOldestElements  ?  TArraySize  :  TArraySize - freeCount + elementCount );
+						return elementCount;
+					}
+
+					size_t dequeueBulkUnlocked( T copyDestination[], size_t maxElementCount ) {
+						const size_type count = Count();
+						const size_type elementCount = (maxElementCount < count)  ?  static_cast<size_type>(maxElementCount)  :  count;
+						if ( elementCount == 0 )  return 0;
+
+						const size_type readIndex = arrayIndex( m_readPosition );
+						const size_type firstSegmentCount = (elementCount < TArraySize - readIndex)  ?  elementCount  :  static_cast<size_type>(TArraySize - readIndex);
+						moveOut( copyDestination, &elementArray()[readIndex], firstSegmentCount );
+						moveOut( copyDestination ? copyDestination + firstSegmentCount : nullptr, &elementArray()[0], static_cast<size_type>(elementCount - firstSegmentCount) );
+						m_readPosition = advance( m_readPosition, elementCount );
+						this->recordDequeue( readIndex, elementCount );
+						return elementCount;
+					}
+
+					T* reserveWriteUnlocked( size_t requestedCount, size_type *reservedCount = nullptr ) {
+						static_assert( std::is_trivially_copyable<T>::value, "Zero-copy regions require trivially copyable elements!" );
+						const size_type contiguousCount = contiguousFreeCount( m_readPosition, m_writePosition );
+						const size_type elementCount = (requestedCount < contiguousCount)  ?  static_cast<size_type>(requestedCount)  :  contiguousCount;
+						if ( reservedCount )  *reservedCount = elementCount;
+						if ( elementCount == 0 )  return 0;
+						return &elementArray()[arrayIndex(m_writePosition)];
+					}
+
+					void commitWriteUnlocked( size_t writtenCount ) {
+						static_assert( std::is_trivially_copyable<T>::value, "Zero-copy regions require trivially copyable elements!" );
+						const size_type readPosition = m_readPosition, writePosition = m_writePosition;
+						const size_type contiguousCount = contiguousFreeCount( readPosition, writePosition );
+						const size_type elementCount = (writtenCount < contiguousCount)  ?  static_cast<size_type>(writtenCount)  :  contiguousCount;
+						m_writePosition = advance( writePosition, elementCount );
+						if ( elementCount > 0 )  this->recordEnqueue( arrayIndex(writePosition), elementCount, countBetween(readPosition, writePosition) + elementCount );
+					}
+
+					T* peekReadUnlocked( size_type *elementCount = nullptr ) {
+						const size_type count = Count();
+						const size_type untilArrayEnd = static_cast<size_type>( TArraySize - arrayIndex(m_readPosition) );
+						if ( elementCount )  *elementCount = (count < untilArrayEnd)  ?  count  :  untilArrayEnd;
+						if ( count == 0 )  return 0;
+						return &elementArray()[arrayIndex(m_readPosition)];
+					}
+
+					T* peekUnlocked() {
+						if ( isEmpty() )  {
 							return 0;
 						}
-						uint_fast8_t returnedArrayElement = m_nextReadIndex;
-						while (index) {
-							returnedArrayElement++;  if ( returnedArrayElement >= TArraySize )   returnedArrayElement = 0;
-							index--;
+						T* retPtr = &elementArray()[arrayIndex(m_readPosition)];
+						return retPtr;
+					}
+
+					T* peekUnlocked( size_type index ) {
+						if ( index >= Count() )  {
+							return 0;
 						}
-						T* retPtr = &m_elementArray[returnedArrayElement];
+						T* retPtr = &elementArray()[arrayIndex( advance(m_readPosition, index) )];
 						return retPtr;
 					}
 
+					/// Copy-constructs 'count' elements within unconstructed slots. Trivially copyable types get copied using memcpy.
+					static void constructCopies( T *slots, const T *source, size_type count ) {
+						if ( std::is_trivially_copyable<T>::value ) {
+							memcpy( static_cast<void*>(slots), source, count * sizeof(T) );
+						} else {
+							for (size_type i = 0; i<count; i++)  new (&slots[i]) T( source[i] );
+						}
+					}
+
+					/// Moves 'count' elements out of their slots (or discards them, if 'destination' is NULL) and destroys them.
+					static void moveOut( T *destination, T *slots, size_type count ) {
+						if ( std::is_trivially_copyable<T>::value ) {
+							if ( destination )  memcpy( static_cast<void*>(destination), slots, count * sizeof(T) );
+						} else {
+							for (size_type i = 0; i<count; i++) {
+								if ( destination )  destination[i] = std::move( slots[i] );
+								slots[i].~T();
+							}
+						}
+					}
+
+					/// Destroys 'count' elements from 'position' on. Nothing to do for trivially destructible types.
+					void destroyElements( size_type position, size_type count ) {
+						if ( std::is_trivially_destructible<T>::value )  return;
+						for ( ; count > 0; count--) {
+							elementArray()[arrayIndex(position)].~T();
+							position = advance( position, 1 );
+						}
+					}
+
+					void destroyAllElements() {
+						if ( std::is_trivially_destructible<T>::value )  return;
+						destroyElements( m_readPosition, Count() );
+					}
+
+					/// Takes over the positions, statistics and elements of another Fifo. The elements are copy-constructed at the
+					/// same array indices, so that they match the recorded statistics. All slots must be unconstructed.
+					void copyFrom( const Fifo& other ) {
+						static_cast<statistics_type&>( *this ) = other;
+						m_readPosition = other.m_readPosition;
+						m_writePosition = other.m_writePosition;
+						const size_type count = Count();
+						const size_type readIndex = arrayIndex( m_readPosition );
+						const size_type untilArrayEnd = static_cast<size_type>( TArraySize - readIndex );
+						const size_type firstSegmentCount = (count < untilArrayEnd)  ?  count  :  untilArrayEnd;
+						constructCopies( &elementArray()[readIndex], &other.elementArray()[readIndex], firstSegmentCount );
+						constructCopies( &elementArray()[0], &other.elementArray()[0], static_cast<size_type>(count - firstSegmentCount) );
+					}
+
+					/// Number of free slots from the write position on, until the end of the array or the first used slot.
+					static inline size_type contiguousFreeCount( size_type readPosition, size_type writePosition ) {
+						const size_type freeCount = static_cast<size_type>( TArraySize - countBetween(readPosition, writePosition) );
+						const size_type untilArrayEnd = static_cast<size_type>( TArraySize - arrayIndex(writePosition) );
+						return (freeCount < untilArrayEnd)  ?  freeCount  :  untilArrayEnd;
+					}
+
+					/// Number of elements between a read and a write position.
+					static inline size_type countBetween( size_type readPosition, size_type writePosition ) {
+						if ( IsPowerOfTwo )  return static_cast<size_type>( writePosition - readPosition );
+						return static_cast<size_type>( (writePosition >= readPosition)  ?  writePosition - readPosition  :  writePosition + 2*TArraySize - readPosition );
+					}
+
+					/// Maps a read or write position onto the corresponding array index.
+					static inline size_type arrayIndex( size_type position ) {
+						if ( IsPowerOfTwo )  return static_cast<size_type>( position & (TArraySize - 1) );
+						return static_cast<size_type>( (position >= TArraySize)  ?  position - TArraySize  :  position );
+					}
+
+					/// Moves a read or write position forward by 'distance' (at most TArraySize) elements.
+					static inline size_type advance( size_type position, size_t distance ) {
+						if ( IsPowerOfTwo )  return static_cast<size_type>( position + distance );
+						const size_t advancedPosition = position + distance;
+						return static_cast<size_type>( (advancedPosition >= 2*TArraySize)  ?  advancedPosition - 2*TArraySize  :  advancedPosition );
+					}
 
 				private:
-					std::array<T, TArraySize> m_elementArray; 	///< Contains all elements.
-					volatile uint_fast8_t m_nextReadIndex;     	///< Always points to the field containing the oldest element.
-					volatile uint_fast8_t m_nextWriteIndex;    	///< Always points to the next free field.
-					volatile uint_fast8_t m_elementCount;      	///< Contains the amount of used elements.
+					std::array<storage_t, TArraySize> m_elementStorage; 	///< Contains all elements. Only the slots between read and write position are constructed.
+					volatile size_type m_readPosition;       	///< Position of the oldest element. @see arrayIndex()
+					volatile size_type m_writePosition;      	///< Position of the next free field. @see arrayIndex()
 
 			}; /* class */
 
@@ -0,0 +1,234 @@
+/*
+ * FifoStatistics.h
+ *
+ *  Created on: 16.10.2026
+ *      Author: agent
+ *
+ *  Description:
+ *    Statistics policies for @see Fifo, which help to choose its capacity. They are passed as the last template
+ *    argument of the Fifo and can be read at runtime:
+ *
+ *      Fifo<Sample, true, 32, NoMutex, FifoStatistics<DwtCycleCounter>> samples;
+ *      ...
+ *      if ( samples.statistics().overwrittenCount() > 0 )  log( "Samples lost, peak %u", samples.statistics().peakCount() );
+ *
+ *    Available policies:
+ *      - NoFifoStatistics: The default. Neither occupies memory nor generates any code,
+ *      - FifoStatistics<>: Counts the peak occupancy (high-water mark), rejected elements (Fifo was full) and
+ *        overwritten elements (overwrite mode),
+ *      - FifoStatistics<TCycleCounter>: Additionally measures the time each element spends within the Fifo, from
+ *        being applied until being removed. Requires one time stamp per slot.
+ *
+ *    A cycle counter provides 'value_type' (an unsigned integer) and a static function 'now()'. Wrap-arounds of the
+ *    counter are fine as long as no element stays longer than one counter period. @see DwtCycleCounter
+ *
+ *    Further information:
+ *      - no usage of dynamic memory,
+ *      - the statistics are updated within the Fifo's locked sections; reading them does not lock the Mutex. The
+ *        residence times may be torn by a concurrent update unless read via Fifo::lock(),
+ *      - discarded elements (clear() or destruction) are neither counted as overwritten nor measured.
+ */
+#ifndef APPLICATION_USER_LISTS_STATICMEMORY_FIFOSTATISTICS_H_
+#define APPLICATION_USER_LISTS_STATICMEMORY_FIFOSTATISTICS_H_
+
+
+#include <stdint-gcc.h>
+#include <stddef.h>
+#include <array>
+#include <type_traits>
+
+namespace Util {
+	namespace Lists {
+		namespace StaticMemory {
+
+			/**
+			 * Disables the statistics. Empty; all hooks are no-ops.
+			 */
+			class NoFifoStatistics {
+				public:
+					template <size_t TArraySize>
+					using Recorder = NoFifoStatistics;
+
+				protected:
+					inline void recordEnqueue( size_t, size_t, size_t ) {}
+					inline void recordDequeue( size_t, size_t ) {}
+					inline void recordRejection( size_t ) {}
+					inline void recordOverwrite( size_t ) {}
+					inline void reset() {}
+			};
+
+
+			/**
+			 * Cycle counter which disables the measurement of residence times.
+			 */
+			struct NoCycleCounter {};
+
+
+			#if defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__) || defined(__ARM_ARCH_8M_MAIN__)
+				/**
+				 * Cycle counter of the Cortex-M3/M4/M7/M33 Data Watchpoint and Trace unit (DWT). Counts CPU clock cycles,
+				 * thus wraps around after 2^32 cycles (e.g. about 54 s at 80 MHz). Needs to be started once by @see enable().
+				 */
+				struct DwtCycleCounter {
+					using value_type = uint32_t;
+
+					static void enable() {
+						*reinterpret_cast<volatile uint32_t*>( 0xE000EDFCu ) |= UINT32_C(1) << 24;   // DEMCR.TRCENA: Enables the DWT
+						*reinterpret_cast<volatile uint32_t*>( 0xE0001FB0u ) = UINT32_C(0xC5ACCE55); // DWT_LAR: Unlocks the DWT (Cortex-M7 only; ignored otherwise)
+						*reinterpret_cast<volatile uint32_t*>( 0xE0001004u ) = 0;                    // DWT_CYCCNT
+						*reinterpret_cast<volatile uint32_t*>( 0xE0001000u ) |= UINT32_C(1);         // DWT_CTRL.CYCCNTENA
+					}
+
+					static inline value_type now() {
+						return *reinterpret_cast<volatile uint32_t*>( 0xE0001004u );
+					}
+				};
+			#endif
+
+
+			/**
+			 * Counters for peak occupancy, rejected and overwritten elements.
+			 */
+			class FifoCounters {
+				public:
+					FifoCounters() : m_peakCount(0), m_rejectedCount(0), m_overwrittenCount(0) {}
+
+					/**
+					 * Returns the maximum number of elements which were present at the same time (high-water mark).
+					 */
+					inline uint32_t peakCount() const {
+						return m_peakCount;
+					}
+
+					/**
+					 * Returns the number of elements which could not be applied, because the Fifo was full.
+					 * Always 0 in overwrite mode.
+					 */
+					inline uint32_t rejectedCount() const {
+						return m_rejectedCount;
+					}
+
+					/**
+					 * Returns the number of elements which got lost by being overwritten. In case of a bulk transfer
+					 * exceeding the capacity, this includes the given elements which were never stored.
+					 */
+					inline uint32_t overwrittenCount() const {
+						return m_overwrittenCount;
+					}
+
+				protected:
+					/// Elements were applied at the array indices [firstIndex .. firstIndex+count), wrapping around at the capacity. 'occupancy' is the resulting element count.
+					inline void recordEnqueue( size_t firstIndex, size_t count, size_t occupancy ) {
+						(void) firstIndex;  (void) count;
+						if ( occupancy > m_peakCount )  m_peakCount = static_cast<uint32_t>( occupancy );
+					}
+
+					/// Elements were removed from the array indices [firstIndex .. firstIndex+count).
+					inline void recordDequeue( size_t, size_t ) {}
+
+					inline void recordRejection( size_t count ) {
+						m_rejectedCount += static_cast<uint32_t>( count );
+					}
+
+					inline void recordOverwrite( size_t count ) {
+						m_overwrittenCount += static_cast<uint32_t>( count );
+					}
+
+					void reset() {
+						m_peakCount = m_rejectedCount = m_overwrittenCount = 0;
+					}
+
+				private:
+					uint32_t m_peakCount;
+					uint32_t m_rejectedCount;
+					uint32_t m_overwrittenCount;
+			};
+
+
+			/**
+			 * Counters plus the residence time of the elements, measured in ticks of TCycleCounter.
+			 */
+			template <typename TCycleCounter, size_t TArraySize>
+			class FifoResidenceRecorder : public FifoCounters {
+					static_assert( std::is_unsigned<typename TCycleCounter::value_type>::value, "The cycle counter's value_type must be an unsigned integer type!" );
+
+				public:
+					using time_type = typename TCycleCounter::value_type;
+
+					FifoResidenceRecorder() : m_enqueueTimes(), m_measurementCount(0), m_totalTime(0), m_minTime(0), m_maxTime(0) {}
+
+					/**
+					 * Returns the number of elements whose residence time was measured.
+					 */
+					inline uint32_t measurementCount() const {
+						return m_measurementCount;
+					}
+
+					/**
+					 * Returns the shortest, longest and average residence time. All of them are 0 if nothing was measured yet.
+					 */
+					inline time_type minResidenceTime() const {
+						return m_minTime;
+					}
+					inline time_type maxResidenceTime() const {
+						return m_maxTime;
+					}
+					inline time_type averageResidenceTime() const {
+						return (m_measurementCount == 0)  ?  0  :  static_cast<time_type>( m_totalTime / m_measurementCount );
+					}
+
+				protected:
+					void recordEnqueue( size_t firstIndex, size_t count, size_t occupancy ) {
+						FifoCounters::recordEnqueue( firstIndex, count, occupancy );
+						const time_type now = TCycleCounter::now();
+						for (size_t index = firstIndex; count > 0; count--)
+							m_enqueueTimes[wrap(index++)] = now;
+					}
+
+					void recordDequeue( size_t firstIndex, size_t count ) {
+						const time_type now = TCycleCounter::now();
+						for (size_t index = firstIndex; count > 0; count--) {
+							const time_type residenceTime = static_cast<time_type>( now - m_enqueueTimes[wrap(index++)] );
+							if ( m_measurementCount == 0  ||  residenceTime < m_minTime )  m_minTime = residenceTime;
+							if ( residenceTime > m_maxTime )  m_maxTime = residenceTime;
+							m_totalTime += residenceTime;
+							m_measurementCount++;
+						}
+					}
+
+					void reset() {
+						FifoCounters::reset();
+						m_measurementCount = 0;
+						m_totalTime = 0;
+						m_minTime = m_maxTime = 0;
+					}
+
+				private:
+					static inline size_t wrap( size_t index ) {
+						return (index >= TArraySize)  ?  index - TArraySize  :  index;
+					}
+
+					std::array<time_type, TArraySize> m_enqueueTimes;   	///< Time stamp of each slot's element.
+					uint32_t                          m_measurementCount;
+					uint64_t                          m_totalTime;
+					time_type                         m_minTime;
+					time_type                         m_maxTime;
+			};
+
+
+			/**
+			 * Enables the statistics. With a cycle counter other than NoCycleCounter, the residence times get measured as well.
+			 */
+			template <typename TCycleCounter = NoCycleCounter>
+			struct FifoStatistics {
+				template <size_t TArraySize>
+				using Recorder = typename std::conditional<std::is_same<TCycleCounter, NoCycleCounter>::value,
+														   FifoCounters,
+														   FifoResidenceRecorder<TCycleCounter, TArraySize>>::type;
+			};
+
+		} /*namespace StaticMemory*/
+	} /* namespace Lists */
+} /* namespace Util */
+
+#endif /* APPLICATION_USER_LISTS_STATICMEMORY_FIFOSTATISTICS_H_ */
@@ -0,0 +1,300 @@
+/*
+ * HashMap.h
+ *
+ *  Created on: 16.10.2026
+ *      Author: agent
+ *
+ *  Description:
+ *    This class contains a fixed-capacity hash map using open addressing with Robin Hood hashing, e.g. for
+ *    registries and ID lookups which would otherwise need a linear search.
+ *
+ *    Robin Hood hashing keeps each probe sequence sorted by the distance of the elements to their home slot.
+ *    Thus, a lookup can stop as soon as it meets an element that is closer to its home slot than the searched
+ *    key would be. Removing elements shifts their successors back, so no tombstones are needed.
+ *
+ *    Further information:
+ *      - no usage of dynamic memory,
+ *      - keys, values and probe distances are kept in separate arrays (SoA). Probing only touches the compact
+ *        distance and key arrays; the values are accessed once the key is found,
+ *      - deterministic worst case: no element is ever placed more than TMaxProbeCount slots away from its home
+ *        slot. An insertion that would violate this bound fails instead. Thus, each lookup compares at most
+ *        TMaxProbeCount keys,
+ *      - keys must be trivially copyable (IDs, pointers, hashes, ..); values may be any type,
+ *      - in order to prevent race conditions, the use of Mutexes is possible,
+ *      - a load factor of up to about 80 % usually works well; beyond, insertions may fail due to the probe bound.
+ */
+#ifndef APPLICATION_USER_LISTS_STATICMEMORY_HASHMAP_H_
+#define APPLICATION_USER_LISTS_STATICMEMORY_HASHMAP_H_
+
+
+#include <stdint-gcc.h>
+#include <stddef.h>
+#include <array>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include <Mutex/LockPolicy.h>
+#include <Mutex/NoMutex.h>
+
+namespace Util {
+	namespace Lists {
+		namespace StaticMemory {
+
+			/**
+			 * Default hash for integers, enums and pointers (Fibonacci hashing). For other key types, provide a
+			 * functor returning a uint32_t, whose upper bits should be well distributed.
+			 */
+			template <typename TKey>
+			struct Hash {
+				static_assert( std::is_integral<TKey>::value || std::is_enum<TKey>::value || std::is_pointer<TKey>::value, "No default hash for this key type; please provide one!" );
+
+				uint32_t operator()( const TKey &key ) const {
+					const uint64_t value = toInteger( key, std::is_pointer<TKey>() );
+					return static_cast<uint32_t>( value ^ (value >> 32) ) * UINT32_C(2654435769);
+				}
+
+				private:
+					static uint64_t toInteger( const TKey &key, std::false_type )  { return static_cast<uint64_t>( key ); }
+					static uint64_t toInteger( const TKey &key, std::true_type )   { return reinterpret_cast<uintptr_t>( key ); }
+			};
+
+
+
+			template <typename TKey, typename TValue, uint_fast16_t TCapacity, uint_fast8_t TMaxProbeCount = 16, typename THash = Hash<TKey>, typename MutexImpl = Util::Mutex::NoMutex>
+			class HashMap {
+				static_assert( Util::Mutex::IsLockPolicy<MutexImpl>::value, "The given Mutex type must provide static lock(), unlock() and try_lock()! @see Mutex/LockPolicy.h" );
+				static_assert( TCapacity > 0  &&  TCapacity < UINT16_MAX, "TCapacity must be within range [1 .. 65534]!" );
+				static_assert( TMaxProbeCount > 0  &&  TMaxProbeCount < UINT8_MAX, "TMaxProbeCount must be within range [1 .. 254]!" );
+				static_assert( std::is_trivially_copyable<TKey>::value, "TKey must be trivially copyable!" );
+
+				private:
+					/// Narrowest type capable of holding all slot indices.
+					using index_t = typename std::conditional<(TCapacity <= UINT8_MAX), uint8_t, uint16_t>::type;
+
+					/// Number of slots between an element and its home slot, plus one. Zero denotes an empty slot.
+					using distance_t = uint8_t;
+					static constexpr distance_t EmptySlot = 0;
+					static constexpr distance_t MaxDistance = (TMaxProbeCount < TCapacity)  ?  TMaxProbeCount  :  static_cast<distance_t>(TCapacity);
+
+				public:
+
+					HashMap() : m_count(0) {
+						m_distances.fill( distance_t(EmptySlot) );
+					}
+
+					HashMap( const HashMap& ) = delete;
+					HashMap& operator=( const HashMap& ) = delete;
+
+					~HashMap() {
+						destroyAllValues();
+					}
+
+					inline bool isEmpty() const {
+						return m_count == 0;
+					}
+
+					inline bool isFull() const {
+						return m_count >= TCapacity;
+					}
+
+					/**
+					 * Returns the number of present elements.
+					 */
+					inline uint_fast16_t size() const {
+						return m_count;
+					}
+
+					constexpr uint_fast16_t maxSize() const {
+						return TCapacity;
+					}
+
+					/**
+					 * Returns the maximum number of keys a lookup compares.
+					 */
+					constexpr uint_fast8_t maxProbeCount() const {
+						return MaxDistance;
+					}
+
+					/**
+					 * Removes (and destroys) all elements.
+					 */
+					void clear() {
+						Util::Mutex::LockGuard<MutexImpl> _mutex;  // Locks the following code section; upon destruction the section gets unlocked automatically.
+						destroyAllValues();
+						m_distances.fill( distance_t(EmptySlot) );
+						m_count = 0;
+					}
+
+					/**
+					 * Adds an element, unless its key is present already.
+					 *
+					 * @param key             	..	The key.
+					 * @param arguments       	..	Arguments which are passed to the constructor of TValue.
+					 * @return                	..	Returns if the operation was successful, i.e. false if the key is present already, the
+					 *                        	  	map is full, or the element would exceed the probe bound.
+					 */
+					template <typename... TArguments>
+					bool emplace( const TKey &key, TArguments&&... arguments ) {
+						Util::Mutex::LockGuard<MutexImpl> _mutex;  // Locks the following code section; upon destruction the section gets unlocked automatically.
+						if ( isFull() )  return false;
+
+						// Search the key. The search stops at the slot the key belongs to.
+						index_t slot = homeSlotOf( key );
+						distance_t distance = 1;
+						while ( m_distances[slot] >= distance ) {
+							if ( m_distances[slot] == distance  &&  m_keys[slot] == key )  return false;
+							if ( ++distance > MaxDistance )  return false;
+							slot = nextSlot( slot );
+						}
+
+						// The elements from there up to the next empty slot get shifted by one slot. None of them must exceed the probe bound.
+						index_t emptySlot = slot;
+						for (; m_distances[emptySlot] != EmptySlot; emptySlot = nextSlot(emptySlot))
+							if ( m_distances[emptySlot] + 1 > MaxDistance )  return false;
+
+						if ( emptySlot != slot ) {
+							for (index_t destination = emptySlot; destination != slot; ) {
+								const index_t source = previousSlot( destination );
+								moveSlot( destination, source, destination == emptySlot );
+								destination = source;
+							}
+							value(slot).~TValue();
+						}
+						m_keys[slot] = key;
+						m_distances[slot] = distance;
+						new (&value(slot)) TValue( std::forward<TArguments>(arguments)... );
+						m_count++;
+						return true;
+					}
+
+					bool insert( const TKey &key, const TValue &value ) {
+						return emplace( key, value );
+					}
+
+					bool insert( const TKey &key, TValue &&value ) {
+						return emplace( key, std::move(value) );
+					}
+
+					/**
+					 * Looks up a key.
+					 *
+					 * @return                	..	Pointer to the value. Will be NULL if the key is not present.
+					 */
+					TValue* find( const TKey &key ) {
+						Util::Mutex::LockGuard<MutexImpl> _mutex;  // Locks the following code section; upon destruction the section gets unlocked automatically.
+						const index_t slot = findSlot( key );
+						return (slot == TCapacity)  ?  nullptr  :  &value(slot);
+					}
+
+					const TValue* find( const TKey &key ) const {
+						Util::Mutex::LockGuard<MutexImpl> _mutex;  // Locks the following code section; upon destruction the section gets unlocked automatically.
+						const index_t slot = findSlot( key );
+						return (slot == TCapacity)  ?  nullptr  :  &value(slot);
+					}
+
+					bool contains( const TKey &key ) const {
+						return find( key ) != nullptr;
+					}
+
+					/**
+					 * Removes an element.
+					 *
+					 * @param moveDestination 	..	The value gets moved there before being removed. May be NULL!
+					 * @return                	..	Returns if the operation was successful, i.e. false if the key was not present.
+					 */
+					bool remove( const TKey &key, TValue *moveDestination = nullptr ) {
+						Util::Mutex::LockGuard<MutexImpl> _mutex;  // Locks the following code section; upon destruction the section gets unlocked automatically.
+						index_t slot = findSlot( key );
+						if ( slot == TCapacity )  return false;
+						if ( moveDestination )  *moveDestination = std::move( value(slot) );
+
+						// Shifts the successors back by one slot, until one is at its home slot (or the slot is empty).
+						for (index_t next = nextSlot(slot); m_distances[next] > 1; next = nextSlot(next)) {
+							m_keys[slot] = m_keys[next];
+							m_distances[slot] = static_cast<distance_t>( m_distances[next] - 1 );
+							value(slot) = std::move( value(next) );
+							slot = next;
+						}
+						value(slot).~TValue();
+						m_distances[slot] = EmptySlot;
+						m_count--;
+						return true;
+					}
+
+					/**
+					 * Calls a function for each element, in no particular order. The Mutex is locked only once for the whole pass.
+					 *
+					 * @param function 	..	Callable taking (const TKey&, TValue&), or (const TKey&, const TValue&) for const instances.
+					 */
+					template <typename TFunction>
+					void forEach( TFunction function ) {
+						Util::Mutex::LockGuard<MutexImpl> _mutex;  // Locks the following code section; upon destruction the section gets unlocked automatically.
+						for (index_t slot = 0; slot<TCapacity; slot++)
+							if ( m_distances[slot] != EmptySlot )  function( static_cast<const TKey&>(m_keys[slot]), value(slot) );
+					}
+					template <typename TFunction>
+					void forEach( TFunction function ) const {
+						Util::Mutex::LockGuard<MutexImpl> _mutex;  // Locks the following code section; upon destruction the section gets unlocked automatically.
+						for (index_t slot = 0; slot<TCapacity; slot++)
+							if ( m_distances[slot] != EmptySlot )  function( m_keys[slot], value(slot) );
+					}
+
+
+				private:
+					using storage_t = typename std::aligned_storage<sizeof(TValue), alignof(TValue)>::type;
+
+					inline TValue& value( index_t slot )              { return *reinterpret_cast<TValue*>( &m_valueStorage[slot] ); }
+					inline const TValue& value( index_t slot ) const  { return *reinterpret_cast<const TValue*>( &m_valueStorage[slot] ); }
+
+					/// Maps the hash onto [0 .. TCapacity) by multiplication, which avoids a division for any capacity.
+					static inline index_t homeSlotOf( const TKey &key ) {
+						return static_cast<index_t>( (static_cast<uint64_t>(THash()(key)) * TCapacity) >> 32 );
+					}
+
+					static inline index_t nextSlot( index_t slot ) {
+						return (slot + 1u < TCapacity)  ?  static_cast<index_t>(slot + 1)  :  0;
+					}
+
+					static inline index_t previousSlot( index_t slot ) {
+						return (slot > 0)  ?  static_cast<index_t>(slot - 1)  :  static_cast<index_t>(TCapacity - 1);
+					}
+
+					/// Returns the slot containing the key, or TCapacity if it is not present.
+					index_t findSlot( const TKey &key ) const {
+						index_t slot = homeSlotOf( key );
+						for (distance_t distance = 1; distance <= MaxDistance  &&  m_distances[slot] >= distance; distance++) {
+							if ( m_distances[slot] == distance  &&  m_keys[slot] == key )  return slot;
+							slot = nextSlot( slot );
+						}
+						return TCapacity;
+					}
+
+					/// Moves an element one slot further away from its home slot.
+					void moveSlot( index_t destination, index_t source, bool destinationIsEmpty ) {
+						m_keys[destination] = m_keys[source];
+						m_distances[destination] = static_cast<distance_t>( m_distances[source] + 1 );
+						if ( destinationIsEmpty )  new (&value(destination)) TValue( std::move(value(source)) );
+						else  value(destination) = std::move( value(source) );
+					}
+
+					void destroyAllValues() {
+						if ( std::is_trivially_destructible<TValue>::value )  return;
+						for (index_t slot = 0; slot<TCapacity; slot++)
+							if ( m_distances[slot] != EmptySlot )  value(slot).~TValue();
+					}
+
+
+				private:
+					std::array<distance_t, TCapacity>  m_distances;      ///< Probe distance (plus one) of each slot's element; EmptySlot if unused.
+					std::array<TKey, TCapacity>        m_keys;
+					std::array<storage_t, TCapacity>   m_valueStorage;
+					index_t                            m_count;
+
+			}; /* class */
+
+		} /*namespace StaticMemory*/
+	} /* namespace Lists */
+} /* namespace Util */
+
+#endif /* APPLICATION_USER_LISTS_STATICMEMORY_HASHMAP_H_ */
@@ -0,0 +1,356 @@
+/*
+ * IntrusiveList.h
+ *
+ *  Created on: 16.10.2026
+ *      Author: agent
+ *
+ *  Description:
+ *  	Implements an intrusive doubly linked list. Instead of copying elements into the list, the elements embed
+ *  	the links themselves by deriving from @see IntrusiveListHook. Thus, objects which already live in static
+ *  	memory (timers, buttons, storages, ..) can be chained without duplicating them.
+ *
+ *  	Example:
+ *  	  class Task : public IntrusiveListHook<> { .. };
+ *  	  Task a, b;
+ *  	  IntrusiveList<Task> tasks;
+ *  	  tasks.addTail( a );  tasks.addTail( b );
+ *  	  tasks.remove( a );
+ *
+ *  	Further information:
+ *      - no usage of dynamic memory, no copying of elements,
+ *      - adding and removing elements takes O(1); size() needs to walk the list,
+ *      - an element may be part of one list per hook. Deriving from hooks with different tags (e.g.
+ *        IntrusiveListHook<ReadyTag> and IntrusiveListHook<TimerTag>) allows to link it into several lists,
+ *      - an element unlinks itself upon destruction. This doesn't lock the list's Mutex,
+ *      - in order to prevent race conditions, the use of Mutexes is possible.
+ */
+
+#ifndef APPLICATION_USER_LISTS_STATICMEMORY_INTRUSIVELIST_H_
+#define APPLICATION_USER_LISTS_STATICMEMORY_INTRUSIVELIST_H_
+
+#include <stdint-gcc.h>
+#include <stddef.h>
+#include <iterator>
+#include <type_traits>
+
+#include <Mutex/LockPolicy.h>
+#include <Mutex/NoMutex.h>
+
+namespace Util {
+	namespace Lists {
+		namespace StaticMemory {
+
+			template <typename T, typename TTag, typename MutexImpl> class IntrusiveList;
+
+
+			/**
+			 * Links embedded into an element of @see IntrusiveList. Derive from it to make a class linkable.
+			 *
+			 * @param TTag 	..	Distinguishes several hooks within the same class. Any (even incomplete) type.
+			 */
+			template <typename TTag = void>
+			class IntrusiveListHook {
+					template <typename, typename, typename> friend class IntrusiveList;
+
+				public:
+					IntrusiveListHook() : _next(nullptr), _previous(nullptr) {}
+
+					/// Copies of an element are not linked; assigning an element doesn't change its linkage.
+					IntrusiveListHook( const IntrusiveListHook& ) : IntrusiveListHook() {}
+					IntrusiveListHook& operator=( const IntrusiveListHook& )  { return *this; }
+
+					~IntrusiveListHook() {
+						unlink();
+					}
+
+					/**
+					 * Returns if the element is currently part of a list.
+					 */
+					bool isLinked() const {
+						return _next != nullptr;
+					}
+
+					/**
+					 * Removes the element from the list it is part of, if any, in O(1).
+					 *
+					 * @remark Doesn't lock the list's Mutex. Use @see IntrusiveList::remove() if the list is shared with ISRs.
+					 */
+					void unlink() {
+						if ( !isLinked() )  return;
+						_previous->_next = _next;
+						_next->_previous = _previous;
+						_next = nullptr;
+						_previous = nullptr;
+					}
+
+				private:
+					/// Inserts this (unlinked) hook in front of another one.
+					void linkBefore( IntrusiveListHook *next ) {
+						_next = next;
+						_previous = next->_previous;
+						_previous->_next = this;
+						next->_previous = this;
+					}
+
+					IntrusiveListHook *_next;       ///< NULL while unlinked. Lists are circular, so a linked hook always has both neighbours.
+					IntrusiveListHook *_previous;
+			};
+
+
+
+			template <typename T, typename TTag = void, typename MutexImpl = Util::Mutex::NoMutex>
+			class IntrusiveList {
+				static_assert( Util::Mutex::IsLockPolicy<MutexImpl>::value, "The given Mutex type must provide static lock(), unlock() and try_lock()! @see Mutex/LockPolicy.h" );
+				static_assert( std::is_base_of<IntrusiveListHook<TTag>, T>::value, "T must derive from IntrusiveListHook<TTag>!" );
+
+				private:
+					using hook_t = IntrusiveListHook<TTag>;
+
+					static T* toElement( hook_t *hook )              { return static_cast<T*>( hook ); }
+					static const T* toElement( const hook_t *hook )  { return static_cast<const T*>( hook ); }
+
+				public:
+					/**
+					 * Bidirectional iterator over the list, from head to tail. Usable with range-for and <algorithm>.
+					 *
+					 * @remark Iterators don't lock the Mutex. Removing the referenced element invalidates the iterator;
+					 *         all other iterators stay valid.
+					 */
+					template <typename TElement, typename THook>
+					class IteratorTemplate {
+							template <typename, typename> friend class IteratorTemplate;
+							friend class IntrusiveList;
+
+						public:
+							using iterator_category = std::bidirectional_iterator_tag;
+							using value_type        = typename std::remove_const<TElement>::type;
+							using difference_type   = ptrdiff_t;
+							using pointer           = TElement*;
+							using reference         = TElement&;
+
+							IteratorTemplate() : _hook(nullptr) {}
+
+							/// Allows to convert an iterator into a const_iterator.
+							template <typename TOther, typename TOtherHook, typename std::enable_if<std::is_convertible<TOther*, TElement*>::value>::type* = nullptr>
+							IteratorTemplate(const IteratorTemplate<TOther, TOtherHook>& other) : _hook(other._hook) {}
+
+							reference operator*() const   { return *toElement( _hook ); }
+							pointer operator->() const    { return toElement( _hook ); }
+
+							IteratorTemplate& operator++()     { _hook = _hook->_next;  return *this; }
+							IteratorTemplate operator++(int)   { IteratorTemplate previous = *this;  ++*this;  return previous; }
+							IteratorTemplate& operator--()     { _hook = _hook->_previous;  return *this; }
+							IteratorTemplate operator--(int)   { IteratorTemplate previous = *this;  --*this;  return previous; }
+
+							friend bool operator==(const IteratorTemplate& a, const IteratorTemplate& b)  { return a._hook == b._hook; }
+							friend bool operator!=(const IteratorTemplate& a, const IteratorTemplate& b)  { return a._hook != b._hook; }
+
+						private:
+							explicit IteratorTemplate(THook *hook) : _hook(hook) {}
+
+							THook *_hook;   ///< The list's root refers to end().
+					};
+
+					using iterator       = IteratorTemplate<T, hook_t>;
+					using const_iterator = IteratorTemplate<const T, const hook_t>;
+
+
+					IntrusiveList() {
+						_root._next = &_root;
+						_root._previous = &_root;
+					}
+
+					IntrusiveList( const IntrusiveList& ) = delete;
+					IntrusiveList& operator=( const IntrusiveList& ) = delete;
+
+					/**
+					 * Unlinks all elements; the elements themselves stay untouched.
+					 */
+					~IntrusiveList() {
+						clearUnlocked();
+					}
+
+					bool isEmpty() const {
+						return _root._next == &_root;
+					}
+
+					/**
+					 * Returns the number of elements. Needs to walk the list.
+					 */
+					uint_fast16_t size() const {
+						Util::Mutex::LockGuard<MutexImpl> _mutex;  // Locks the following code section; upon destruction the section gets unlocked automatically.
+						uint_fast16_t count = 0;
+						for (const hook_t *hook = _root._next; hook != &_root; hook = hook->_next)  count++;
+						return count;
+					}
+
+					/**
+					 * Unlinks all elements; the elements themselves stay untouched.
+					 */
+					void clear() {
+						Util::Mutex::LockGuard<MutexImpl> _mutex;  // Locks the following code section; upon destruction the section gets unlocked automatically.
+						clearUnlocked();
+					}
+
+					/**
+					 * Links an element in front of the current head.
+					 *
+					 * @return        	..	Returns if the operation was successful, i.e. false if the element is already part of a list.
+					 */
+					bool addHead(T& element) {
+						Util::Mutex::LockGuard<MutexImpl> _mutex;  // Locks the following code section; upon destruction the section gets unlocked automatically.
+						return linkBefore( element, _root._next );
+					}
+
+					/**
+					 * Links an element behind the current tail.
+					 *
+					 * @return        	..	Returns if the operation was successful, i.e. false if the element is already part of a list.
+					 */
+					bool addTail(T& element) {
+						Util::Mutex::LockGuard<MutexImpl> _mutex;  // Locks the following code section; upon destruction the section gets unlocked automatically.
+						return linkBefore( element, &_root );
+					}
+
+					bool add(T& element) {
+						return addTail( element );
+					}
+
+					/**
+					 * Links an element in front of the given position.
+					 *
+					 * @param position	..	Iterator to the element the new one is linked in front of. end() appends at the tail.
+					 * @return        	..	Returns if the operation was successful, i.e. false if the element is already part of a list.
+					 */
+					bool add(const_iterator position, T& element) {
+						Util::Mutex::LockGuard<MutexImpl> _mutex;  // Locks the following code section; upon destruction the section gets unlocked automatically.
+						return linkBefore( element, const_cast<hook_t*>(position._hook) );
+					}
+
+					/**
+					 * Unlinks the head element.
+					 *
+					 * @return        	..	Pointer to the unlinked element. Will be NULL if the list was empty.
+					 */
+					T* removeHead() {
+						Util::Mutex::LockGuard<MutexImpl> _mutex;  // Locks the following code section; upon destruction the section gets unlocked automatically.
+						return unlinkUnlocked( _root._next );
+					}
+
+					/**
+					 * Unlinks the tail element.
+					 *
+					 * @return        	..	Pointer to the unlinked element. Will be NULL if the list was empty.
+					 */
+					T* removeTail() {
+						Util::Mutex::LockGuard<MutexImpl> _mutex;  // Locks the following code section; upon destruction the section gets unlocked automatically.
+						return unlinkUnlocked( _root._previous );
+					}
+
+					/**
+					 * Unlinks an element in O(1).
+					 *
+					 * @remark The element must be part of this list (or of no list at all).
+					 * @return        	..	Returns if the operation was successful, i.e. false if the element wasn't linked.
+					 */
+					bool remove(T& element) {
+						Util::Mutex::LockGuard<MutexImpl> _mutex;  // Locks the following code section; upon destruction the section gets unlocked automatically.
+						hook_t &hook = element;  // --> Avoids calling an overloaded operator& of T
+						return unlinkUnlocked( &hook ) != nullptr;
+					}
+
+					/**
+					 * Unlinks the element referenced by an iterator in O(1).
+					 *
+					 * @return        	..	Iterator to the element that followed the removed one.
+					 */
+					iterator remove(const_iterator position) {
+						Util::Mutex::LockGuard<MutexImpl> _mutex;  // Locks the following code section; upon destruction the section gets unlocked automatically.
+						hook_t *hook = const_cast<hook_t*>( position._hook );
+						hook_t *next = hook->_next;
+						unlinkUnlocked( hook );
+						return iterator( next );
+					}
+
+					/**
+					 * Returns if an element is part of this list. Needs to walk the list.
+					 */
+					bool contains(const T& element) const {
+						Util::Mutex::LockGuard<MutexImpl> _mutex;  // Locks the following code section; upon destruction the section gets unlocked automatically.
+						const hook_t &elementHook = element;
+						for (const hook_t *hook = _root._next; hook != &_root; hook = hook->_next)
+							if ( hook == &elementHook )  return true;
+						return false;
+					}
+
+					/**
+					 * Returns a pointer to the head element. Will be NULL if the list is empty.
+					 */
+					T* getHead() {
+						return isEmpty()  ?  nullptr  :  toElement( _root._next );
+					}
+
+					/**
+					 * Returns a pointer to the tail element. Will be NULL if the list is empty.
+					 */
+					T* getTail() {
+						return isEmpty()  ?  nullptr  :  toElement( _root._previous );
+					}
+
+					iterator begin()              { return iterator( _root._next ); }
+					iterator end()                { return iterator( &_root ); }
+					const_iterator begin() const  { return const_iterator( _root._next ); }
+					const_iterator end() const    { return const_iterator( &_root ); }
+					const_iterator cbegin() const { return begin(); }
+					const_iterator cend() const   { return end(); }
+
+					/**
+					 * Calls a function for each element, from head to tail. The Mutex is locked only once for the whole pass.
+					 *
+					 * @remark The function may unlink the element it was called for, but no other elements.
+					 * @param function 	..	Callable taking T& (or const T& for const instances).
+					 */
+					template <typename TFunction>
+					void forEach(TFunction function) {
+						Util::Mutex::LockGuard<MutexImpl> _mutex;  // Locks the following code section; upon destruction the section gets unlocked automatically.
+						for (hook_t *hook = _root._next; hook != &_root; ) {
+							hook_t *next = hook->_next;
+							function( *toElement(hook) );
+							hook = next;
+						}
+					}
+					template <typename TFunction>
+					void forEach(TFunction function) const {
+						Util::Mutex::LockGuard<MutexImpl> _mutex;  // Locks the following code section; upon destruction the section gets unlocked automatically.
+						for (const T &element : *this)  function( element );
+					}
+
+
+				private:
+					bool linkBefore(T& element, hook_t *next) {
+						hook_t &hook = element;
+						if ( hook.isLinked() )  return false;
+						hook.linkBefore( next );
+						return true;
+					}
+
+					T* unlinkUnlocked(hook_t *hook) {
+						if ( hook == &_root  ||  !hook->isLinked() )  return nullptr;
+						hook->unlink();
+						return toElement( hook );
+					}
+
+					void clearUnlocked() {
+						while ( !isEmpty() )  _root._next->unlink();
+					}
+
+					hook_t _root;   ///< Sentinel; the list is circular through it. Its successor is the head, its predecessor the tail.
+
+			};
+
+		} /* namespace StaticMemory */
+	} /* namespace Lists */
+} /* namespace Util */
+
+
+#endif /* APPLICATION_USER_LISTS_STATICMEMORY_INTRUSIVELIST_H_ */
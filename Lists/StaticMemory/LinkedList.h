@@ -5,20 +5,29 @@
  *      Author: Robert Voelckner
  *
  *  Description:
- *  	Implements a doubly linked list for POD value types.
+ *  	Implements a doubly linked list. Elements are constructed in place within uninitialized storage, so that
+ *  	non-POD types are possible, too.
  *
  *  	Further information:
  *      - no usage of dynamic memory,
- *      - in order to prevent race conditions, the use of Mutexes is possible.
+ *      - in order to prevent race conditions, the use of Mutexes is possible,
+ *      - elements are linked by array indices of the narrowest sufficient type (8 or 16 bits) instead of pointers,
+ *      - unused slots form a free list, which is linked using the same indices. Thus, adding and removing
+ *        elements takes O(1); only positional access (e.g. operator[]) needs to walk the list.
  */
 
 #ifndef APPLICATION_USER_LISTS_STATICMEMORY_LINKEDLIST_H_
 #define APPLICATION_USER_LISTS_STATICMEMORY_LINKEDLIST_H_
 
 #include <stdint-gcc.h>
+#include <stddef.h>
 #include <array>
+#include <iterator>
+#include <new>
+#include <type_traits>
+#include <utility>
 
-#include <Mutex/MutexBase.h>
+#include <Mutex/LockPolicy.h>
 #include <Mutex/NoMutex.h>
 
 namespace Util {
@@ -27,112 +36,358 @@ namespace Util {
 
 			template <typename T, uint_fast16_t Size, typename MutexImpl = Util::Mutex::NoMutex>
 			class LinkedList {
-				static_assert( std::is_constructible<MutexImpl>::value, "The given Mutex type must be constructible using the non-arguments-constructor!" );
-				static_assert( std::is_pod<T>::value, "T must be Plain-Old-Data!" );
+				static_assert( Util::Mutex::IsLockPolicy<MutexImpl>::value, "The given Mutex type must provide static lock(), unlock() and try_lock()! @see Mutex/LockPolicy.h" );
+				static_assert( Size > 0  &&  Size < UINT16_MAX, "Size must be within range [1 .. 65534]!" );
 
 				private:
 					/*********************** INTERNAL TYPES *************************/
-					using index_t = uint_fast16_t;
+					/// Narrowest type capable of holding all indices plus InvalidIndex.
+					using index_t = typename std::conditional<(Size < UINT8_MAX), uint8_t, uint16_t>::type;
+
+					static constexpr index_t InvalidIndex = static_cast<index_t>( ~static_cast<index_t>(0) );
 
 					struct element_t {
-						bool containsValidData;
-						element_t *nextElement;
-						element_t *previousElement;
-						T data;
+						typename std::aligned_storage<sizeof(T), alignof(T)>::type storage;  ///< Holds a constructed T while the element is part of the list.
+						index_t nextIndex;      ///< Next element of the list; or next free element, while being part of the free list.
+						index_t previousIndex;  ///< Previous element of the list. Unused while being part of the free list.
+
+						inline T& data() {
+							return *reinterpret_cast<T*>( &storage );
+						}
+						inline const T& data() const {
+							return *reinterpret_cast<const T*>( &storage );
+						}
 					};
 
 					/*************************** FIELDS *****************************/
 					std::array<element_t, Size> _elements;
 					index_t                     _elementsCount;
 
-					element_t                  *_headElement, *_tailElement;
+					index_t                     _headIndex, _tailIndex;
+					index_t                     _freeHeadIndex;           ///< First element of the free list.
 
 					/****************************************************************/
 
-					element_t *findNextFreeSlot() {
-						for (index_t i = 0; i<Size; i++) {
-							if (_elements[i].containsValidData)  return &(_elements[i]);
+					/// Takes an element from the free list. Returns InvalidIndex if the list is full.
+					index_t allocateElement() {
+						const index_t index = _freeHeadIndex;
+						if ( index != InvalidIndex )  _freeHeadIndex = _elements[index].nextIndex;
+						return index;
+					}
+
+					/// Destroys an (already unlinked) element and puts it back onto the free list.
+					void releaseElement(index_t index) {
+						_elements[index].data().~T();
+						_elements[index].nextIndex = _freeHeadIndex;
+						_freeHeadIndex = index;
+					}
+
+					/// Inserts an element in front of 'nextIndex'. If nextIndex is InvalidIndex, the element becomes the new tail.
+					void linkElement(index_t index, index_t nextIndex) {
+						const index_t previousIndex = (nextIndex == InvalidIndex)  ?  _tailIndex  :  _elements[nextIndex].previousIndex;
+						_elements[index].nextIndex = nextIndex;
+						_elements[index].previousIndex = previousIndex;
+						if ( previousIndex == InvalidIndex )  _headIndex = index;
+						else                                  _elements[previousIndex].nextIndex = index;
+						if ( nextIndex == InvalidIndex )      _tailIndex = index;
+						else                                  _elements[nextIndex].previousIndex = index;
+						_elementsCount++;
+					}
+
+					void unlinkElement(index_t index) {
+						const index_t previousIndex = _elements[index].previousIndex, nextIndex = _elements[index].nextIndex;
+						if ( previousIndex == InvalidIndex )  _headIndex = nextIndex;
+						else                                  _elements[previousIndex].nextIndex = nextIndex;
+						if ( nextIndex == InvalidIndex )      _tailIndex = previousIndex;
+						else                                  _elements[nextIndex].previousIndex = previousIndex;
+						_elementsCount--;
+					}
+
+					template <typename... TArguments>
+					bool emplaceBefore(index_t nextIndex, TArguments&&... arguments) {
+						const index_t index = allocateElement();
+						if ( index == InvalidIndex )  return false;
+						new (&_elements[index].storage) T( std::forward<TArguments>(arguments)... );
+						linkElement( index, nextIndex );
+						return true;
+					}
+
+					/// Removes an element, optionally moving it out before.
+					void removeElement(index_t index, T *moveDestination) {
+						if ( moveDestination )  *moveDestination = std::move( _elements[index].data() );
+						unlinkElement( index );
+						releaseElement( index );
+					}
+
+					/// Walks to the element at a given position, starting from the nearer end of the list.
+					index_t findIndex(uint_fast16_t position) const {
+						if ( position >= _elementsCount )  return InvalidIndex;
+						index_t index;
+						if ( position < _elementsCount / 2 ) {
+							index = _headIndex;
+							for ( ; position > 0; position--)  index = _elements[index].nextIndex;
+						} else {
+							index = _tailIndex;
+							for (position = _elementsCount - 1 - position; position > 0; position--)  index = _elements[index].previousIndex;
 						}
-						return nullptr;
+						return index;
+					}
+
+					void clearUnlocked() {
+						while ( _headIndex != InvalidIndex )  removeElement( _headIndex, nullptr );
 					}
 
 					/****************************************************************/
 
 				public:
+					/**
+					 * Bidirectional iterator over the list, from head to tail. Usable with range-for and <algorithm>.
+					 *
+					 * @remark Iterators don't lock the Mutex. Removing the referenced element invalidates the iterator;
+					 *         all other iterators stay valid.
+					 */
+					template <typename TList, typename TElement>
+					class IteratorTemplate {
+							template <typename, typename> friend class IteratorTemplate;
+							friend class LinkedList;
+
+						public:
+							using iterator_category = std::bidirectional_iterator_tag;
+							using value_type        = typename std::remove_const<TElement>::type;
+							using difference_type   = ptrdiff_t;
+							using pointer           = TElement*;
+							using reference         = TElement&;
+
+							IteratorTemplate() : _list(nullptr), _index(InvalidIndex) {}
+
+							/// Allows to convert an iterator into a const_iterator.
+							template <typename TOtherList, typename TOther, typename std::enable_if<std::is_convertible<TOther*, TElement*>::value>::type* = nullptr>
+							IteratorTemplate(const IteratorTemplate<TOtherList, TOther>& other) : _list(other._list), _index(other._index) {}
+
+							reference operator*() const   { return _list->_elements[_index].data(); }
+							pointer operator->() const    { return &**this; }
+
+							IteratorTemplate& operator++()     { _index = _list->_elements[_index].nextIndex;  return *this; }
+							IteratorTemplate operator++(int)   { IteratorTemplate previous = *this;  ++*this;  return previous; }
+							IteratorTemplate& operator--() {
+								_index = (_index == InvalidIndex)  ?  _list->_tailIndex  :  _list->_elements[_index].previousIndex;
+								return *this;
+							}
+							IteratorTemplate operator--(int)   { IteratorTemplate previous = *this;  --*this;  return previous; }
+
+							friend bool operator==(const IteratorTemplate& a, const IteratorTemplate& b)  { return a._index == b._index; }
+							friend bool operator!=(const IteratorTemplate& a, const IteratorTemplate& b)  { return a._index != b._index; }
+
+						private:
+							IteratorTemplate(TList *list, index_t index) : _list(list), _index(index) {}
+
+							TList   *_list;
+							index_t  _index;   ///< InvalidIndex refers to end().
+					};
+
+					using iterator       = IteratorTemplate<LinkedList, T>;
+					using const_iterator = IteratorTemplate<const LinkedList, const T>;
+
+
 					LinkedList() {
 						_elementsCount = 0;
 						for (index_t i = 0; i<Size; i++) {
-							_elements[i].containsValidData = false;
+							_elements[i].nextIndex = static_cast<index_t>( i + 1 );
 						}
-						_headElement = nullptr;
-						_tailElement = nullptr;
+						_elements[Size - 1].nextIndex = InvalidIndex;
+						_freeHeadIndex = 0;
+						_headIndex = InvalidIndex;
+						_tailIndex = InvalidIndex;
 					}
 
-					uint_fast16_t size() {
+					LinkedList( const LinkedList& ) = delete;
+					LinkedList& operator=( const LinkedList& ) = delete;
+
+					~LinkedList() {
+						if ( std::is_trivially_destructible<T>::value )  return;
+						clearUnlocked();
+					}
+
+					uint_fast16_t size() const {
 						return _elementsCount;
 					}
 
-					constexpr uint_fast16_t maxSize() {
+					constexpr uint_fast16_t maxSize() const {
 						return Size;
 					}
 
-					bool addHead(T& value) {
-						if ( _elementsCount >= Size )  return false;
+					bool isEmpty() const {
+						return _elementsCount == 0;
+					}
 
-						element_t *ptr;
-						if ( _headElement == nullptr ) {
-							_headElement = _tailElement = _elements;
-							ptr = _headElement;
-						} else {
-							ptr = findNextFreeSlot();
-							ptr->nextElement = _headElement;
-							_headElement->previousElement = ptr;
-							_headElement = ptr;
-						}
-						ptr->containsValidData = true;
-						ptr->data = value;
+					bool isFull() const {
+						return _elementsCount >= Size;
+					}
 
-						_elementsCount++;
-						return true;
+					/**
+					 * Removes (and destroys) all elements.
+					 */
+					void clear() {
+						Util::Mutex::LockGuard<MutexImpl> _mutex;  // Locks the following code section; upon destruction the section gets unlocked automatically.
+						clearUnlocked();
+					}
+
+					/**
+					 * Adds an element in front of the current head.
+					 *
+					 * @return        	..	Returns if the operation was successful, i.e. false if the list is full.
+					 */
+					bool addHead(const T& value) {
+						return emplaceHead( value );
+					}
+
+					bool addHead(T&& value) {
+						return emplaceHead( std::move(value) );
+					}
+
+					template <typename... TArguments>
+					bool emplaceHead(TArguments&&... arguments) {
+						Util::Mutex::LockGuard<MutexImpl> _mutex;  // Locks the following code section; upon destruction the section gets unlocked automatically.
+						return emplaceBefore( _headIndex, std::forward<TArguments>(arguments)... );
 					}
 
-					bool addTail(T& value) {
-						while(1);
-						// TODO
+					/**
+					 * Adds an element behind the current tail.
+					 *
+					 * @return        	..	Returns if the operation was successful, i.e. false if the list is full.
+					 */
+					bool addTail(const T& value) {
+						return emplaceTail( value );
 					}
 
-					bool add(T& value) {
+					bool addTail(T&& value) {
+						return emplaceTail( std::move(value) );
+					}
+
+					template <typename... TArguments>
+					bool emplaceTail(TArguments&&... arguments) {
+						Util::Mutex::LockGuard<MutexImpl> _mutex;  // Locks the following code section; upon destruction the section gets unlocked automatically.
+						return emplaceBefore( InvalidIndex, std::forward<TArguments>(arguments)... );
+					}
+
+					bool add(const T& value) {
 						return addTail(value);
 					}
 
-					void removeHead() {
-						while(1);
-						// TODO
+					bool add(T&& value) {
+						return addTail( std::move(value) );
+					}
+
+					/**
+					 * Inserts an element in front of the given position.
+					 *
+					 * @param position	..	Iterator to the element the new one is inserted in front of. end() appends at the tail.
+					 * @return        	..	Returns if the operation was successful, i.e. false if the list is full.
+					 */
+					template <typename... TArguments>
+					bool emplace(const_iterator position, TArguments&&... arguments) {
+						Util::Mutex::LockGuard<MutexImpl> _mutex;  // Locks the following code section; upon destruction the section gets unlocked automatically.
+						return emplaceBefore( position._index, std::forward<TArguments>(arguments)... );
+					}
+
+					/**
+					 * Removes the head element.
+					 *
+					 * @param moveDestination	..	The element gets moved there before being removed. May be NULL!
+					 * @return               	..	Returns if the operation was successful, i.e. false if the list was empty.
+					 */
+					bool removeHead(T *moveDestination = nullptr) {
+						Util::Mutex::LockGuard<MutexImpl> _mutex;  // Locks the following code section; upon destruction the section gets unlocked automatically.
+						if ( _headIndex == InvalidIndex )  return false;
+						removeElement( _headIndex, moveDestination );
+						return true;
+					}
+
+					/**
+					 * Removes the tail element.
+					 *
+					 * @param moveDestination	..	The element gets moved there before being removed. May be NULL!
+					 * @return               	..	Returns if the operation was successful, i.e. false if the list was empty.
+					 */
+					bool removeTail(T *moveDestination = nullptr) {
+						Util::Mutex::LockGuard<MutexImpl> _mutex;  // Locks the following code section; upon destruction the section gets unlocked automatically.
+						if ( _tailIndex == InvalidIndex )  return false;
+						removeElement( _tailIndex, moveDestination );
+						return true;
 					}
 
-					void removeTail() {
-						while(1);
-						// TODO
+					/**
+					 * Removes the element at a given position (0 = head). Needs to walk the list.
+					 *
+					 * @return        	..	Returns if the operation was successful, i.e. false if there is no element at the given position.
+					 */
+					bool remove(uint_fast16_t index) {
+						Util::Mutex::LockGuard<MutexImpl> _mutex;  // Locks the following code section; upon destruction the section gets unlocked automatically.
+						const index_t elementIndex = findIndex( index );
+						if ( elementIndex == InvalidIndex )  return false;
+						removeElement( elementIndex, nullptr );
+						return true;
 					}
 
-					void remove(uint_fast16_t index) {
-						while(1);
-						// TODO
+					/**
+					 * Removes the element referenced by an iterator in O(1).
+					 *
+					 * @return        	..	Iterator to the element that followed the removed one.
+					 */
+					iterator remove(const_iterator position) {
+						Util::Mutex::LockGuard<MutexImpl> _mutex;  // Locks the following code section; upon destruction the section gets unlocked automatically.
+						const index_t nextIndex = _elements[position._index].nextIndex;
+						removeElement( position._index, nullptr );
+						return iterator( this, nextIndex );
 					}
 
+					/**
+					 * Returns a pointer to the head element. Will be NULL if the list is empty.
+					 */
 					T* getHead() {
-						while(1);
-						// TODO
+						Util::Mutex::LockGuard<MutexImpl> _mutex;  // Locks the following code section; upon destruction the section gets unlocked automatically.
+						return (_headIndex == InvalidIndex)  ?  nullptr  :  &_elements[_headIndex].data();
 					}
 
+					/**
+					 * Returns a pointer to the tail element. Will be NULL if the list is empty.
+					 */
 					T* getTail() {
-						while(1);
-						// TODO
+						Util::Mutex::LockGuard<MutexImpl> _mutex;  // Locks the following code section; upon destruction the section gets unlocked automatically.
+						return (_tailIndex == InvalidIndex)  ?  nullptr  :  &_elements[_tailIndex].data();
 					}
 
+					/**
+					 * Returns a pointer to the element at a given position (0 = head). Needs to walk the list, starting
+					 * from the nearer end. Will be NULL if there is no element at the given position.
+					 */
 					T* operator[] (uint_fast16_t i) {
-						while(1);
-						// TODO
+						Util::Mutex::LockGuard<MutexImpl> _mutex;  // Locks the following code section; upon destruction the section gets unlocked automatically.
+						const index_t elementIndex = findIndex( i );
+						return (elementIndex == InvalidIndex)  ?  nullptr  :  &_elements[elementIndex].data();
+					}
+
+					iterator begin()              { return iterator( this, _headIndex ); }
+					iterator end()                { return iterator( this, InvalidIndex ); }
+					const_iterator begin() const  { return const_iterator( this, _headIndex ); }
+					const_iterator end() const    { return const_iterator( this, InvalidIndex ); }
+					const_iterator cbegin() const { return begin(); }
+					const_iterator cend() const   { return end(); }
+
+					/**
+					 * Calls a function for each element, from head to tail. The Mutex is locked only once for the whole pass.
+					 *
+					 * @param function 	..	Callable taking T& (or const T& for const instances).
+					 */
+					template <typename TFunction>
+					void forEach(TFunction function) {
+						Util::Mutex::LockGuard<MutexImpl> _mutex;  // Locks the following code section; upon destruction the section gets unlocked automatically.
+						for (T &element : *this)  function( element );
+					}
+					template <typename TFunction>
+					void forEach(TFunction function) const {
+						Util::Mutex::LockGuard<MutexImpl> _mutex;  // Locks the following code section; upon destruction the section gets unlocked automatically.
+						for (const T &element : *this)  function( element );
 					}
 
 			};
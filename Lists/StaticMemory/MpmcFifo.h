@@ -0,0 +1,179 @@
+/*
+ * MpmcFifo.h
+ *
+ *  Created on: 16.10.2026
+ *      Author: agent
+ *
+ *  Description:
+ *    This class contains a bounded lock-free circular buffer for POD value types, which may be used by any number of
+ *    producers and consumers concurrently (e.g. worker threads on a Linux host).
+ *
+ *    Each slot carries a sequence number that tells producers and consumers whether the slot is ready to be
+ *    written or read in the current round. Positions are claimed using compare-and-swap; there is no lock and
+ *    no shared element counter.
+ *
+ *    Further information:
+ *      - no usage of dynamic memory,
+ *      - requires atomic compare-and-swap (not available on Cortex-M0/M0+),
+ *      - the capacity must be a power of two,
+ *      - overwriting the oldest element is not supported.
+ */
+#ifndef APPLICATION_USER_LISTS_STATICMEMORY_MPMCFIFO_H_
+#define APPLICATION_USER_LISTS_STATICMEMORY_MPMCFIFO_H_
+
+
+#include <stdint-gcc.h>
+#include <stddef.h>
+#include <array>
+#include <atomic>
+#include <type_traits>
+
+namespace Util {
+	namespace Lists {
+		namespace StaticMemory {
+
+			template <typename T, size_t TArraySize = 16>
+			class MpmcFifo {
+				static_assert( std::is_pod<T>::value, "T must be Plain-Old-Data!" );
+				static_assert( TArraySize >= 2  &&  (TArraySize & (TArraySize - 1)) == 0, "TArraySize must be a power of two (>= 2)!" );
+
+				private:
+					using sequence_t = size_t;
+					static constexpr sequence_t IndexMask = TArraySize - 1;
+
+					/// On hosts, the positions are put into separate cache lines to prevent false sharing between producers and consumers.
+					#if defined(__x86_64__) || defined(__i386__) || defined(__aarch64__)
+						static constexpr size_t PositionAlignment = 64;
+					#else
+						static constexpr size_t PositionAlignment = alignof(std::atomic<sequence_t>);
+					#endif
+
+					struct Slot {
+						std::atomic<sequence_t> sequence;  ///< Equals the position if writable, position+1 if readable.
+						T                       element;
+					};
+
+				public:
+
+					MpmcFifo() {
+						for (sequence_t i = 0; i<TArraySize; i++)
+							m_slots[i].sequence.store( i, std::memory_order_relaxed );
+						m_enqueuePosition.store( 0, std::memory_order_relaxed );
+						m_dequeuePosition.store( 0, std::memory_order_relaxed );
+					}
+
+					MpmcFifo( const MpmcFifo& ) = delete;
+
+					/**
+					 * Returns if the circular buffer is empty.
+					 *
+					 * @remark Since producers and consumers run concurrently, the result is a snapshot only.
+					 */
+					inline bool isEmpty(void) const {
+						return Count() == 0;
+					}
+
+					/**
+					 * Returns if the circular buffer is full.
+					 *
+					 * @remark Since producers and consumers run concurrently, the result is a snapshot only.
+					 */
+					inline bool isFull(void) const {
+						return Count() >= TArraySize;
+					}
+
+					/**
+					 * Returns the maximum size of the circular buffer.
+					 */
+					inline size_t size() const {
+						return TArraySize;
+					}
+
+					/**
+					 * Returns the number of present elements.
+					 *
+					 * @remark Since producers and consumers run concurrently, the result is a snapshot only.
+					 */
+					inline size_t Count() const {
+						const sequence_t dequeuePosition = m_dequeuePosition.load(std::memory_order_acquire);
+						const sequence_t enqueuePosition = m_enqueuePosition.load(std::memory_order_acquire);
+						const sequence_t count = enqueuePosition - dequeuePosition;
+						return (count > TArraySize)  ?  0  :  count;  // --> Both positions might have been read in between concurrent operations.
+					}
+
+					/**
+					 * Applies (copies) one element to the circular buffer. May be called by any number of producers concurrently.
+					 *
+					 * @remark In case the circular buffer is full, the element won't be copied.
+					 *
+					 * @param copyFromElement 	..	The element that will be applied.
+					 * @return                	..	Returns if the operation was successful.
+					 */
+					bool enqueue( const T& copyFromElement ) {
+						Slot *slot;
+						sequence_t position = m_enqueuePosition.load(std::memory_order_relaxed);
+						while (1) {
+							slot = &m_slots[position & IndexMask];
+							const sequence_t sequence = slot->sequence.load(std::memory_order_acquire);
+							const intptr_t difference = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position);
+							if ( difference == 0 ) {
+								if ( m_enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed) )  break;
+							} else if ( difference < 0 ) {
+								return false;  // --> The slot still holds an element of the previous round, i.e. the buffer is full.
+							} else {
+								position = m_enqueuePosition.load(std::memory_order_relaxed);
+							}
+						}
+						slot->element = copyFromElement;
+						slot->sequence.store( position + 1, std::memory_order_release );  // Publishes the element to consumers
+						return true;
+					}
+
+					/**
+					 * Fetches the oldest element and removes it from circular buffer. May be called by any number of consumers concurrently.
+					 *
+					 * @param copyDestination 	..	Holds the destination the element should be copied to. May be NULL!
+					 * @return                	..	Returns if the operation was successful.
+					 *                    	      	  true:  The operation was successful.
+					 *                    	      	  false: The circular buffer was empty; operation not successful.
+					 */
+					bool dequeue( T *copyDestination ) {
+						Slot *slot;
+						sequence_t position = m_dequeuePosition.load(std::memory_order_relaxed);
+						while (1) {
+							slot = &m_slots[position & IndexMask];
+							const sequence_t sequence = slot->sequence.load(std::memory_order_acquire);
+							const intptr_t difference = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position + 1);
+							if ( difference == 0 ) {
+								if ( m_dequeuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed) )  break;
+							} else if ( difference < 0 ) {
+								return false;  // --> The slot wasn't written in this round yet, i.e. the buffer is empty.
+							} else {
+								position = m_dequeuePosition.load(std::memory_order_relaxed);
+							}
+						}
+						if (copyDestination)  *copyDestination = slot->element;
+						slot->sequence.store( position + TArraySize, std::memory_order_release );  // Hands the slot over to the producers of the next round
+						return true;
+					}
+
+					/**
+					 * Discards the oldest element.
+					 */
+					void dequeue(void) {
+						dequeue(nullptr);
+					}
+
+
+				private:
+					std::array<Slot, TArraySize>                             m_slots;          	///< Contains all elements.
+					alignas(PositionAlignment) std::atomic<sequence_t>       m_enqueuePosition;	///< Position the next producer will claim. Free-running.
+					alignas(PositionAlignment) std::atomic<sequence_t>       m_dequeuePosition;	///< Position the next consumer will claim. Free-running.
+
+			}; /* class */
+
+		} /*namespace StaticMemory*/
+	} /* namespace Lists */
+} /* namespace Util */
+
+#endif /* APPLICATION_USER_LISTS_STATICMEMORY_MPMCFIFO_H_ */
@@ -0,0 +1,273 @@
+/*
+ * Pool.h
+ *
+ *  Created on: 16.10.2026
+ *      Author: agent
+ *
+ *  Description:
+ *    This class contains a typed pool of fixed-size blocks, from which objects can be allocated and released
+ *    in O(1). Unused blocks form a free list, whose links are stored within the blocks themselves (except for
+ *    the lock-free mode, see below).
+ *
+ *    Further information:
+ *      - no usage of dynamic memory,
+ *      - in order to prevent race conditions, the use of Mutexes is possible,
+ *      - alternatively, the lock-free mode manages the free list using compare-and-swap. Then allocate() and
+ *        release() may be called from ISRs and threads concurrently, without disabling interrupts. Requires
+ *        atomic compare-and-swap (not available on Cortex-M0/M0+). The free list links take one extra byte
+ *        (two bytes for 255 or more blocks) per block then,
+ *      - objects may be owned by a @see Pool::Handle, which releases them automatically,
+ *      - usage counters (current, peak, failed allocations) help to dimension the capacity.
+ */
+#ifndef APPLICATION_USER_LISTS_STATICMEMORY_POOL_H_
+#define APPLICATION_USER_LISTS_STATICMEMORY_POOL_H_
+
+
+#include <stdint-gcc.h>
+#include <stddef.h>
+#include <array>
+#include <atomic>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include <Mutex/LockPolicy.h>
+#include <Mutex/NoMutex.h>
+
+namespace Util {
+	namespace Lists {
+		namespace StaticMemory {
+
+			template <typename T, uint_fast16_t TCapacity, typename MutexImpl = Util::Mutex::NoMutex, bool LockFree = false>
+			class Pool {
+				static_assert( Util::Mutex::IsLockPolicy<MutexImpl>::value, "The given Mutex type must provide static lock(), unlock() and try_lock()! @see Mutex/LockPolicy.h" );
+				static_assert( TCapacity > 0  &&  TCapacity < UINT16_MAX, "TCapacity must be within range [1 .. 65534]!" );
+				static_assert( !LockFree  ||  std::is_same<MutexImpl, Util::Mutex::NoMutex>::value, "The lock-free mode doesn't need a Mutex!" );
+
+				private:
+					/// Narrowest type capable of holding all block indices plus InvalidIndex.
+					using index_t = typename std::conditional<(TCapacity < UINT8_MAX), uint8_t, uint16_t>::type;
+					static constexpr index_t InvalidIndex = static_cast<index_t>( ~static_cast<index_t>(0) );
+
+					/// A free block holds the index of the next free block; an allocated block holds a T.
+					/// In lock-free mode, a context might still read a block's link while another one has already popped the
+					/// block and constructs an object within. The compare-and-swap discards such stale links, yet the access
+					/// would be a data race. Thus, the links are kept in a separate array then.
+					using link_t = std::atomic<index_t>;
+					static constexpr size_t BlockSize      = (sizeof(T) > sizeof(link_t))  ?  sizeof(T)  :  sizeof(link_t);
+					static constexpr size_t BlockAlignment = (alignof(T) > alignof(link_t))  ?  alignof(T)  :  alignof(link_t);
+					using block_t = typename std::aligned_storage<BlockSize, BlockAlignment>::type;
+
+					/// In lock-free mode, the free list head carries a tag in its upper 16 bits. It changes with each operation,
+					/// so that a compare-and-swap fails if the head was popped and pushed again in between (ABA problem).
+					using head_t    = typename std::conditional<LockFree, std::atomic<uint32_t>, index_t>::type;
+					using counter_t = typename std::conditional<LockFree, std::atomic<index_t>, index_t>::type;
+
+				public:
+					/**
+					 * Owns an object allocated from the pool and releases it upon destruction. Movable, but not copyable.
+					 */
+					class Handle {
+							friend class Pool;
+
+						public:
+							Handle() : m_pool(nullptr), m_object(nullptr) {}
+							Handle( Handle &&other ) : m_pool(other.m_pool), m_object(other.m_object)  { other.m_object = nullptr; }
+							Handle( const Handle& ) = delete;
+							~Handle()  { reset(); }
+
+							Handle& operator=( Handle &&other ) {
+								if ( this != &other ) {
+									reset();
+									m_pool = other.m_pool;  m_object = other.m_object;
+									other.m_object = nullptr;
+								}
+								return *this;
+							}
+							Handle& operator=( const Handle& ) = delete;
+
+							T* get() const                 { return m_object; }
+							T& operator*() const           { return *m_object; }
+							T* operator->() const          { return m_object; }
+							explicit operator bool() const { return m_object != nullptr; }
+
+							/**
+							 * Releases the owned object (if any) back to the pool.
+							 */
+							void reset() {
+								if ( m_object )  m_pool->release( m_object );
+								m_object = nullptr;
+							}
+
+							/**
+							 * Gives up ownership without releasing the object. It then needs to be released via @see Pool::release().
+							 */
+							T* detach() {
+								T *object = m_object;
+								m_object = nullptr;
+								return object;
+							}
+
+						private:
+							Handle( Pool *pool, T *object ) : m_pool(pool), m_object(object) {}
+
+							Pool *m_pool;
+							T    *m_object;
+					};
+
+
+					Pool() : m_usedCount(0), m_peakUsedCount(0), m_failedAllocationCount(0) {
+						for (index_t i = 0; i<TCapacity; i++) {
+							constructLink( i );
+							link(i).store( static_cast<index_t>(i + 1), std::memory_order_relaxed );
+						}
+						link(TCapacity - 1).store( InvalidIndex, std::memory_order_relaxed );
+						initializeFreeHead( std::integral_constant<bool, LockFree>() );
+					}
+
+					Pool( const Pool& ) = delete;
+					Pool& operator=( const Pool& ) = delete;
+
+					/**
+					 * Allocates a block and constructs an object within.
+					 *
+					 * @param arguments       	..	Arguments which are passed to the constructor of T.
+					 * @return                	..	Pointer to the object. Will be NULL if the pool is exhausted.
+					 */
+					template <typename... TArguments>
+					T* allocate( TArguments&&... arguments ) {
+						index_t index;
+						{
+							Util::Mutex::LockGuard<MutexImpl> _mutex;  // Locks the following code section; upon destruction the section gets unlocked automatically.
+							index = popFreeBlock( std::integral_constant<bool, LockFree>() );
+							if ( index == InvalidIndex ) {
+								m_failedAllocationCount++;
+								return nullptr;
+							}
+							const index_t usedCount = ++m_usedCount;
+							updatePeakUsedCount( usedCount, std::integral_constant<bool, LockFree>() );
+						}
+						return new (&m_blocks[index]) T( std::forward<TArguments>(arguments)... );
+					}
+
+					/**
+					 * Allocates a block and constructs an object within, which is owned by the returned handle.
+					 *
+					 * @param arguments       	..	Arguments which are passed to the constructor of T.
+					 * @return                	..	Handle owning the object. Will be empty if the pool is exhausted.
+					 */
+					template <typename... TArguments>
+					Handle make( TArguments&&... arguments ) {
+						return Handle( this, allocate(std::forward<TArguments>(arguments)...) );
+					}
+
+					/**
+					 * Destroys an object and returns its block to the pool.
+					 *
+					 * @param object          	..	Object obtained by @see allocate(). Ignored if NULL.
+					 */
+					void release( T *object ) {
+						if ( object == nullptr )  return;
+						object->~T();
+						const index_t index = static_cast<index_t>( reinterpret_cast<block_t*>(object) - m_blocks.data() );
+						constructLink( index );
+
+						Util::Mutex::LockGuard<MutexImpl> _mutex;  // Locks the following code section; upon destruction the section gets unlocked automatically.
+						--m_usedCount;  // --> Before the block becomes available, so that the count never exceeds the capacity
+						pushFreeBlock( index, std::integral_constant<bool, LockFree>() );
+					}
+
+					/**
+					 * Returns if an object is located within this pool.
+					 */
+					bool contains( const T *object ) const {
+						const block_t *block = reinterpret_cast<const block_t*>( object );
+						return block >= m_blocks.data()  &&  block < m_blocks.data() + TCapacity;
+					}
+
+					inline uint_fast16_t capacity() const              { return TCapacity; }
+					inline uint_fast16_t usedCount() const             { return m_usedCount; }
+					inline uint_fast16_t freeCount() const             { return TCapacity - usedCount(); }
+					inline uint_fast16_t peakUsedCount() const         { return m_peakUsedCount; }   ///< Highest number of simultaneously allocated blocks
+					inline uint32_t failedAllocationCount() const      { return m_failedAllocationCount; }
+
+
+				private:
+					inline link_t& link( index_t index ) {
+						return LockFree  ?  m_separateLinks[index]  :  *reinterpret_cast<link_t*>( &m_blocks[index] );
+					}
+
+					/// Turns a block into a free list link, after the object has been destroyed.
+					inline void constructLink( index_t index ) {
+						if ( !LockFree )  new (&m_blocks[index]) link_t( InvalidIndex );
+					}
+
+					/*************** Mutex protected (or single-threaded) free list ***************/
+					void initializeFreeHead( std::false_type ) {
+						m_freeHead = 0;
+					}
+
+					index_t popFreeBlock( std::false_type ) {
+						const index_t index = m_freeHead;
+						if ( index != InvalidIndex )  m_freeHead = link(index).load( std::memory_order_relaxed );
+						return index;
+					}
+
+					void pushFreeBlock( index_t index, std::false_type ) {
+						link(index).store( m_freeHead, std::memory_order_relaxed );
+						m_freeHead = index;
+					}
+
+					void updatePeakUsedCount( index_t usedCount, std::false_type ) {
+						if ( usedCount > m_peakUsedCount )  m_peakUsedCount = usedCount;
+					}
+
+					/***************************** Lock-free free list ****************************/
+					static constexpr uint32_t TagIncrement = UINT32_C(1) << 16;
+
+					void initializeFreeHead( std::true_type ) {
+						m_freeHead.store( 0, std::memory_order_release );
+					}
+
+					index_t popFreeBlock( std::true_type ) {
+						uint32_t head = m_freeHead.load( std::memory_order_acquire );
+						uint32_t newHead;
+						do {
+							const index_t index = static_cast<index_t>( head & 0xFFFF );
+							if ( index == InvalidIndex )  return InvalidIndex;
+							// The block might have been popped by somebody else in the meantime; then the tag has changed and the CAS fails.
+							newHead = ((head + TagIncrement) & ~UINT32_C(0xFFFF)) | link(index).load( std::memory_order_relaxed );
+						} while ( !m_freeHead.compare_exchange_weak(head, newHead, std::memory_order_acq_rel, std::memory_order_acquire) );
+						return static_cast<index_t>( head & 0xFFFF );
+					}
+
+					void pushFreeBlock( index_t index, std::true_type ) {
+						uint32_t head = m_freeHead.load( std::memory_order_relaxed );
+						uint32_t newHead;
+						do {
+							link(index).store( static_cast<index_t>(head & 0xFFFF), std::memory_order_relaxed );
+							newHead = ((head + TagIncrement) & ~UINT32_C(0xFFFF)) | index;
+						} while ( !m_freeHead.compare_exchange_weak(head, newHead, std::memory_order_release, std::memory_order_relaxed) );
+					}
+
+					void updatePeakUsedCount( index_t usedCount, std::true_type ) {
+						index_t peak = m_peakUsedCount.load( std::memory_order_relaxed );
+						while ( usedCount > peak  &&  !m_peakUsedCount.compare_exchange_weak(peak, usedCount, std::memory_order_relaxed) ) {}
+					}
+
+
+				private:
+					std::array<block_t, TCapacity> m_blocks;                 ///< Contains all objects, or free list links.
+					std::array<link_t, LockFree ? TCapacity : 0> m_separateLinks;  ///< Free list links in lock-free mode.
+					head_t                         m_freeHead;               ///< Index of the first free block (plus tag, in lock-free mode).
+					counter_t                      m_usedCount;
+					counter_t                      m_peakUsedCount;
+					typename std::conditional<LockFree, std::atomic<uint32_t>, uint32_t>::type m_failedAllocationCount;
+
+			}; /* class */
+
+		} /*namespace StaticMemory*/
+	} /* namespace Lists */
+} /* namespace Util */
+
+#endif /* APPLICATION_USER_LISTS_STATICMEMORY_POOL_H_ */
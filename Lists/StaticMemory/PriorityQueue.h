@@ -0,0 +1,325 @@
+/*
+ * PriorityQueue.h
+ *
+ *  Created on: 16.10.2026
+ *      Author: agent
+ *
+ *  Description:
+ *    This class contains a fixed-capacity priority queue (d-ary heap), e.g. for deadline scheduling or top-K tracking.
+ *    The element for which TCompare(element, other) holds against all others is on top; with the default
+ *    std::less<T>, that's the smallest element (e.g. the earliest deadline).
+ *
+ *    Each element gets a handle upon pushing. It stays valid until the element leaves the queue and allows to
+ *    remove or re-prioritize the element in O(log n).
+ *
+ *    Further information:
+ *      - no usage of dynamic memory,
+ *      - push(), pop(), remove() and update() take O(log n); peek() takes O(1),
+ *      - in order to prevent race conditions, the use of Mutexes is possible,
+ *      - Arity=4 halves the height of the heap; the four children of an element lie next to each other, so that
+ *        sifting down touches fewer cache lines. Usually faster for pop-heavy use and larger queues,
+ *      - handles get reused once their element left the queue, similar to pointers.
+ */
+#ifndef APPLICATION_USER_LISTS_STATICMEMORY_PRIORITYQUEUE_H_
+#define APPLICATION_USER_LISTS_STATICMEMORY_PRIORITYQUEUE_H_
+
+
+#include <stdint-gcc.h>
+#include <stddef.h>
+#include <array>
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include <Mutex/LockPolicy.h>
+#include <Mutex/NoMutex.h>
+
+namespace Util {
+	namespace Lists {
+		namespace StaticMemory {
+
+			template <typename T, uint_fast16_t TCapacity, typename TCompare = std::less<T>, uint_fast8_t Arity = 2, typename MutexImpl = Util::Mutex::NoMutex>
+			class PriorityQueue {
+				static_assert( Util::Mutex::IsLockPolicy<MutexImpl>::value, "The given Mutex type must provide static lock(), unlock() and try_lock()! @see Mutex/LockPolicy.h" );
+				static_assert( TCapacity > 0  &&  TCapacity < UINT16_MAX, "TCapacity must be within range [1 .. 65534]!" );
+				static_assert( Arity >= 2, "Arity must be at least 2!" );
+
+				private:
+					/// Narrowest type capable of holding all positions and handles plus InvalidHandle.
+					using index_t = typename std::conditional<(TCapacity < UINT8_MAX), uint8_t, uint16_t>::type;
+
+				public:
+					using handle_type = index_t;
+					static constexpr handle_type InvalidHandle = static_cast<handle_type>( ~static_cast<handle_type>(0) );
+
+
+					PriorityQueue() : m_elementStorage(), m_count(0) {
+						for (index_t i = 0; i<TCapacity; i++) {
+							m_handleOfPosition[i] = i;
+							m_positionOfHandle[i] = i;
+						}
+					}
+
+					PriorityQueue( const PriorityQueue& ) = delete;
+					PriorityQueue& operator=( const PriorityQueue& ) = delete;
+
+					~PriorityQueue() {
+						destroyAllElements();
+					}
+
+					inline bool isEmpty() const {
+						return m_count == 0;
+					}
+
+					inline bool isFull() const {
+						return m_count >= TCapacity;
+					}
+
+					/**
+					 * Returns the number of present elements.
+					 */
+					inline uint_fast16_t size() const {
+						return m_count;
+					}
+
+					constexpr uint_fast16_t maxSize() const {
+						return TCapacity;
+					}
+
+					/**
+					 * Removes (and destroys) all elements. All handles become invalid.
+					 */
+					void clear() {
+						Util::Mutex::LockGuard<MutexImpl> _mutex;  // Locks the following code section; upon destruction the section gets unlocked automatically.
+						destroyAllElements();
+						m_count = 0;
+					}
+
+					/**
+					 * Adds an element.
+					 *
+					 * @param arguments       	..	Arguments which are passed to the constructor of T.
+					 * @return                	..	Handle of the new element. Will be InvalidHandle if the queue is full.
+					 */
+					template <typename... TArguments>
+					handle_type emplace( TArguments&&... arguments ) {
+						Util::Mutex::LockGuard<MutexImpl> _mutex;  // Locks the following code section; upon destruction the section gets unlocked automatically.
+						if ( isFull() )  return InvalidHandle;
+						const index_t position = m_count;
+						const handle_type handle = m_handleOfPosition[position];  // --> Positions behind the last element hold the unused handles.
+						new (&element(position)) T( std::forward<TArguments>(arguments)... );
+						m_count++;
+						siftUp( position );
+						return handle;
+					}
+
+					handle_type push( const T& value ) {
+						return emplace( value );
+					}
+
+					handle_type push( T&& value ) {
+						return emplace( std::move(value) );
+					}
+
+					/**
+					 * Returns a pointer to the top element, without removing it. Will be NULL if the queue is empty.
+					 *
+					 * @param handle          	..	Receives the handle of the top element. May be NULL!
+					 */
+					const T* peek( handle_type *handle = nullptr ) const {
+						Util::Mutex::LockGuard<MutexImpl> _mutex;  // Locks the following code section; upon destruction the section gets unlocked automatically.
+						if ( isEmpty() )  return nullptr;
+						if ( handle )  *handle = m_handleOfPosition[0];
+						return &element(0);
+					}
+
+					/**
+					 * Removes the top element.
+					 *
+					 * @param moveDestination 	..	The element gets moved there before being removed. May be NULL!
+					 * @return                	..	Returns if the operation was successful, i.e. false if the queue was empty.
+					 */
+					bool pop( T *moveDestination = nullptr ) {
+						Util::Mutex::LockGuard<MutexImpl> _mutex;  // Locks the following code section; upon destruction the section gets unlocked automatically.
+						if ( isEmpty() )  return false;
+						removeAt( 0, moveDestination );
+						return true;
+					}
+
+					/**
+					 * Replaces the top element by a new one in a single pass, which is cheaper than pop() plus push(). If the queue
+					 * is empty, the element gets pushed.
+					 *
+					 * Top-K tracking: Keep the K largest values using std::less; a value is only worth replacing the
+					 * top once the queue is full and the value is larger than the top.
+					 *
+					 * @return                	..	Handle of the new element. The replaced element's handle is reused.
+					 */
+					handle_type replaceTop( const T& value ) {
+						Util::Mutex::LockGuard<MutexImpl> _mutex;  // Locks the following code section; upon destruction the section gets unlocked automatically.
+						const handle_type handle = m_handleOfPosition[0];
+						if ( isEmpty() ) {
+							new (&element(0)) T( value );
+							m_count = 1;
+						} else {
+							element(0) = value;
+							siftDown( 0 );
+						}
+						return handle;
+					}
+
+					/**
+					 * Returns if a handle refers to an element of the queue.
+					 */
+					bool contains( handle_type handle ) const {
+						return handle < TCapacity  &&  m_positionOfHandle[handle] < m_count;
+					}
+
+					/**
+					 * Returns a pointer to the element referred to by a handle. Will be NULL if the handle is invalid.
+					 *
+					 * @remark The element must not be modified in a way that changes its priority; use @see update() instead.
+					 */
+					const T* get( handle_type handle ) const {
+						Util::Mutex::LockGuard<MutexImpl> _mutex;  // Locks the following code section; upon destruction the section gets unlocked automatically.
+						return contains(handle)  ?  &element( m_positionOfHandle[handle] )  :  nullptr;
+					}
+
+					/**
+					 * Removes the element referred to by a handle.
+					 *
+					 * @param moveDestination 	..	The element gets moved there before being removed. May be NULL!
+					 * @return                	..	Returns if the operation was successful, i.e. false if the handle was invalid.
+					 */
+					bool remove( handle_type handle, T *moveDestination = nullptr ) {
+						Util::Mutex::LockGuard<MutexImpl> _mutex;  // Locks the following code section; upon destruction the section gets unlocked automatically.
+						if ( !contains(handle) )  return false;
+						removeAt( m_positionOfHandle[handle], moveDestination );
+						return true;
+					}
+
+					/**
+					 * Assigns a new value to the element referred to by a handle and restores the heap order. The priority may
+					 * both increase and decrease.
+					 *
+					 * @return                	..	Returns if the operation was successful, i.e. false if the handle was invalid.
+					 */
+					bool update( handle_type handle, const T& value ) {
+						Util::Mutex::LockGuard<MutexImpl> _mutex;  // Locks the following code section; upon destruction the section gets unlocked automatically.
+						if ( !contains(handle) )  return false;
+						const index_t position = m_positionOfHandle[handle];
+						element(position) = value;
+						restoreOrder( position );
+						return true;
+					}
+
+					/**
+					 * Decrease-key: Assigns a new value to the element referred to by a handle, which must not move it further
+					 * away from the top (i.e. with std::less, the value must not be larger than before). Only sifts up.
+					 *
+					 * @return                	..	Returns if the operation was successful, i.e. false if the handle was invalid
+					 *                        	  	or the value would lower the element's priority.
+					 */
+					bool decreaseKey( handle_type handle, const T& value ) {
+						Util::Mutex::LockGuard<MutexImpl> _mutex;  // Locks the following code section; upon destruction the section gets unlocked automatically.
+						if ( !contains(handle) )  return false;
+						const index_t position = m_positionOfHandle[handle];
+						if ( TCompare()(element(position), value) )  return false;
+						element(position) = value;
+						siftUp( position );
+						return true;
+					}
+
+
+				private:
+					using storage_t = typename std::aligned_storage<sizeof(T), alignof(T)>::type;
+
+					inline T& element( index_t position )              { return *reinterpret_cast<T*>( &m_elementStorage[position] ); }
+					inline const T& element( index_t position ) const  { return *reinterpret_cast<const T*>( &m_elementStorage[position] ); }
+
+					static inline index_t parentOf( index_t position )      { return static_cast<index_t>( (position - 1) / Arity ); }
+					static inline size_t firstChildOf( index_t position )   { return static_cast<size_t>(position) * Arity + 1; }
+
+					/// Moves an element (along with its handle) to an empty position.
+					inline void moveTo( index_t destination, T &&value, handle_type handle ) {
+						element(destination) = std::move( value );
+						m_handleOfPosition[destination] = handle;
+						m_positionOfHandle[handle] = destination;
+					}
+
+					/// Moves an element towards the top until its parent takes precedence. Parents are moved down into the hole.
+					void siftUp( index_t position ) {
+						if ( position == 0  ||  !TCompare()(element(position), element(parentOf(position))) )  return;
+						T value( std::move(element(position)) );
+						const handle_type handle = m_handleOfPosition[position];
+						do {
+							const index_t parent = parentOf( position );
+							moveTo( position, std::move(element(parent)), m_handleOfPosition[parent] );
+							position = parent;
+						} while ( position > 0  &&  TCompare()(value, element(parentOf(position))) );
+						moveTo( position, std::move(value), handle );
+					}
+
+					/// Moves an element away from the top until it takes precedence over all its children. Children are moved up into the hole.
+					void siftDown( index_t position ) {
+						index_t child = preferredChildOf( position );
+						if ( child == InvalidHandle  ||  !TCompare()(element(child), element(position)) )  return;
+						T value( std::move(element(position)) );
+						const handle_type handle = m_handleOfPosition[position];
+						do {
+							moveTo( position, std::move(element(child)), m_handleOfPosition[child] );
+							position = child;
+							child = preferredChildOf( position );
+						} while ( child != InvalidHandle  &&  TCompare()(element(child), value) );
+						moveTo( position, std::move(value), handle );
+					}
+
+					/// Returns the child which takes precedence over its siblings, or InvalidHandle if there are no children.
+					index_t preferredChildOf( index_t position ) const {
+						const size_t first = firstChildOf( position );
+						if ( first >= m_count )  return InvalidHandle;
+						const size_t last = (first + Arity < m_count)  ?  first + Arity  :  m_count;
+						index_t preferred = static_cast<index_t>( first );
+						for (size_t child = first + 1; child<last; child++)
+							if ( TCompare()(element(static_cast<index_t>(child)), element(preferred)) )  preferred = static_cast<index_t>( child );
+						return preferred;
+					}
+
+					void restoreOrder( index_t position ) {
+						if ( position > 0  &&  TCompare()(element(position), element(parentOf(position))) )  siftUp( position );
+						else  siftDown( position );
+					}
+
+					/// Fills the gap with the last element. The removed element's handle moves behind the last element, i.e. becomes unused.
+					void removeAt( index_t position, T *moveDestination ) {
+						if ( moveDestination )  *moveDestination = std::move( element(position) );
+						const index_t last = static_cast<index_t>( m_count - 1 );
+						const handle_type handle = m_handleOfPosition[position];
+						if ( position != last )  moveTo( position, std::move(element(last)), m_handleOfPosition[last] );
+						element(last).~T();
+						m_handleOfPosition[last] = handle;
+						m_positionOfHandle[handle] = last;
+						m_count = last;
+						if ( position != last )  restoreOrder( position );
+					}
+
+					void destroyAllElements() {
+						if ( std::is_trivially_destructible<T>::value )  return;
+						for (index_t i = 0; i<m_count; i++)  element(i).~T();
+					}
+
+
+				private:
+					std::array<storage_t, TCapacity>  m_elementStorage;   ///< Elements in heap order; the children of position i start at i*Arity+1.
+					std::array<index_t, TCapacity>    m_handleOfPosition; ///< Handle of the element at each position. Behind the last element: the unused handles.
+					std::array<index_t, TCapacity>    m_positionOfHandle; ///< Inverse of @see m_handleOfPosition.
+					index_t                           m_count;
+
+			}; /* class */
+
+		} /*namespace StaticMemory*/
+	} /* namespace Lists */
+} /* namespace Util */
+
+#endif /* APPLICATION_USER_LISTS_STATICMEMORY_PRIORITYQUEUE_H_ */
@@ -0,0 +1,252 @@
+/*
+ * RecordFifo.h
+ *
+ *  Created on: 16.10.2026
+ *      Author: agent
+ *
+ *  Description:
+ *    This class contains a lock-free circular byte buffer for variable-length records (e.g. log lines or protocol
+ *    messages), for exactly one producer and one consumer (e.g. ISR and main loop, or two threads). Unlike
+ *    @see Fifo, each record only occupies its actual size plus a small length prefix.
+ *
+ *    Records are never split: Like in a bip buffer, a record that doesn't fit behind the last one is placed at
+ *    the beginning of the buffer instead, and the remaining bytes at the end are skipped. Thus, both the producer
+ *    and the consumer always get one contiguous memory region per record, which allows zero-copy access:
+ *
+ *      uint8_t *payload = fifo.reserve( 64 );            // Producer
+ *      if ( payload )  fifo.commit( snprintf((char*)payload, 64, "x=%d", x) );
+ *
+ *      TLength size;                                     // Consumer
+ *      if ( const uint8_t *record = fifo.peek(&size) ) { process( record, size );  fifo.release(); }
+ *
+ *    Further information:
+ *      - no usage of dynamic memory,
+ *      - no Mutex necessary: Interrupts never get disabled. The producer only writes the write index, the consumer
+ *        only writes the read index. Both are published using release/acquire semantics,
+ *      - only reserve(), commit() and write() may be called by the producer; peek(), release(), read() and clear()
+ *        may be called by the consumer,
+ *      - records start at multiples of sizeof(TLength), so the payload is aligned accordingly,
+ *      - bytes skipped at the end of the buffer are lost for the current round. The largest record that is
+ *        guaranteed to fit into an empty buffer is half of its capacity; @see maxRecordSize().
+ */
+#ifndef APPLICATION_USER_LISTS_STATICMEMORY_RECORDFIFO_H_
+#define APPLICATION_USER_LISTS_STATICMEMORY_RECORDFIFO_H_
+
+
+#include <stdint-gcc.h>
+#include <stddef.h>
+#include <string.h>
+#include <atomic>
+#include <type_traits>
+
+namespace Util {
+	namespace Lists {
+		namespace StaticMemory {
+
+			template <size_t TByteCapacity = 256, typename TLength = uint16_t>
+			class RecordFifo {
+				static_assert( std::is_unsigned<TLength>::value, "TLength must be an unsigned integer type!" );
+				static_assert( TByteCapacity % sizeof(TLength) == 0, "TByteCapacity must be a multiple of sizeof(TLength)!" );
+				static_assert( TByteCapacity >= 4 * sizeof(TLength)  &&  TByteCapacity <= UINT32_MAX, "Invalid TByteCapacity!" );
+
+				private:
+					/// Narrowest type capable of holding all byte indices including TByteCapacity itself.
+					using index_t = typename std::conditional<(TByteCapacity <= UINT16_MAX), uint16_t, uint32_t>::type;
+
+					static constexpr size_t HeaderSize = sizeof(TLength);
+					static constexpr index_t NoRecord = static_cast<index_t>( ~static_cast<index_t>(0) );  ///< Never a valid record start.
+
+					/// Written instead of a header, where the producer skipped the rest of the buffer.
+					static constexpr TLength WrapMarker = static_cast<TLength>( ~static_cast<TLength>(0) );
+
+					/// On hosts, both indices are put into separate cache lines to prevent false sharing between producer and consumer.
+					#if defined(__x86_64__) || defined(__i386__) || defined(__aarch64__)
+						static constexpr size_t IndexAlignment = 64;
+					#else
+						static constexpr size_t IndexAlignment = alignof(std::atomic<index_t>);
+					#endif
+
+					/// Size of a record including its header, rounded up to the record alignment.
+					static inline size_t recordSize( size_t payloadSize ) {
+						return HeaderSize + (payloadSize + HeaderSize - 1) / HeaderSize * HeaderSize;
+					}
+
+				public:
+
+					RecordFifo() : m_bytes(), m_reservedIndex(NoRecord), m_reservedSize(0), m_readIndex(0), m_writeIndex(0) {}
+
+					RecordFifo( const RecordFifo& ) = delete;
+					RecordFifo& operator=( const RecordFifo& ) = delete;
+
+					/**
+					 * Returns the size of the largest record (payload) that fits into the buffer regardless of its current
+					 * fill state, once it is empty.
+					 */
+					static constexpr size_t maxRecordSize() {
+						return ((TByteCapacity / 2 - HeaderSize) / HeaderSize * HeaderSize < WrapMarker)  ?  (TByteCapacity / 2 - HeaderSize) / HeaderSize * HeaderSize  :  WrapMarker - 1;
+					}
+
+					/**
+					 * Returns the buffer's capacity in bytes.
+					 */
+					static constexpr size_t capacity() {
+						return TByteCapacity;
+					}
+
+					/**
+					 * Returns if there are no records.
+					 *
+					 * @remark If called by the producer, the result may be outdated already.
+					 */
+					inline bool isEmpty() const {
+						return m_readIndex.load(std::memory_order_acquire) == m_writeIndex.load(std::memory_order_acquire);
+					}
+
+					/**
+					 * Discards all records. Must only be called by the consumer.
+					 */
+					void clear() {
+						m_readIndex.store( m_writeIndex.load(std::memory_order_acquire), std::memory_order_release );
+					}
+
+					/**
+					 * Reserves a contiguous region for the payload of a new record. Must only be called by the producer.
+					 *
+					 * @remark The record becomes visible to the consumer with @see commit(). Reserving again without committing
+					 *         abandons the previous reservation.
+					 *
+					 * @param size            	..	Maximum payload size the producer is going to write.
+					 * @return                	..	Pointer to the payload region. Will be NULL if there is no room for the record.
+					 */
+					uint8_t* reserve( size_t size ) {
+						m_reservedIndex = NoRecord;
+						if ( size >= WrapMarker )  return nullptr;
+						const size_t requiredSize = recordSize( size );
+						const index_t writeIndex = m_writeIndex.load(std::memory_order_relaxed);
+						const index_t readIndex = m_readIndex.load(std::memory_order_acquire);
+
+						if ( writeIndex >= readIndex ) {
+							if ( writeIndex + requiredSize <= TByteCapacity )   m_reservedIndex = writeIndex;
+							else if ( requiredSize < readIndex )                 m_reservedIndex = 0;  // --> Wraps around. Keeps one gap so that 'full' doesn't look like 'empty'.
+							else                                                 return nullptr;
+						} else {
+							if ( writeIndex + requiredSize < readIndex )         m_reservedIndex = writeIndex;
+							else                                                 return nullptr;
+						}
+						m_reservedSize = static_cast<TLength>( size );
+						return &m_bytes[m_reservedIndex + HeaderSize];
+					}
+
+					/**
+					 * Publishes the record reserved by @see reserve(). Must only be called by the producer.
+					 *
+					 * @param size            	..	Actual payload size. Must not exceed the reserved size; smaller values release the
+					 *                        	  	unused rest of the reservation.
+					 */
+					void commit( size_t size ) {
+						if ( m_reservedIndex == NoRecord )  return;
+						if ( size > m_reservedSize )  size = m_reservedSize;
+						const index_t writeIndex = m_writeIndex.load(std::memory_order_relaxed);
+						if ( m_reservedIndex != writeIndex  &&  TByteCapacity - writeIndex >= HeaderSize )
+							setHeader( writeIndex, WrapMarker );  // --> Tells the consumer to continue at the beginning.
+						setHeader( m_reservedIndex, static_cast<TLength>(size) );
+						m_writeIndex.store( static_cast<index_t>(m_reservedIndex + recordSize(size)), std::memory_order_release );  // Publishes the record to the consumer
+						m_reservedIndex = NoRecord;
+					}
+
+					/**
+					 * Copies a record into the buffer. Must only be called by the producer.
+					 *
+					 * @return                	..	Returns if the operation was successful, i.e. false if there was no room for the record.
+					 */
+					bool write( const void *data, size_t size ) {
+						uint8_t *payload = reserve( size );
+						if ( payload == nullptr )  return false;
+						memcpy( payload, data, size );
+						commit( size );
+						return true;
+					}
+
+					/**
+					 * Returns the oldest record, without removing it. Must only be called by the consumer.
+					 *
+					 * @remark The record stays valid (and may be modified in place) until it gets released.
+					 *
+					 * @param size            	..	Receives the payload size of the record.
+					 * @return                	..	Pointer to the payload. Will be NULL if there are no records.
+					 */
+					uint8_t* peek( TLength *size ) {
+						const index_t recordIndex = oldestRecordIndex();
+						if ( recordIndex == NoRecord )  return nullptr;
+						if ( size )  *size = getHeader( recordIndex );
+						return &m_bytes[recordIndex + HeaderSize];
+					}
+
+					/**
+					 * Removes the oldest record. Must only be called by the consumer.
+					 *
+					 * @return                	..	Returns if the operation was successful, i.e. false if there were no records.
+					 */
+					bool release() {
+						const index_t recordIndex = oldestRecordIndex();
+						if ( recordIndex == NoRecord )  return false;
+						m_readIndex.store( static_cast<index_t>(recordIndex + recordSize(getHeader(recordIndex))), std::memory_order_release );  // Hands the bytes back to the producer
+						return true;
+					}
+
+					/**
+					 * Copies the oldest record and removes it. Must only be called by the consumer.
+					 *
+					 * @param destination     	..	Destination of the payload.
+					 * @param destinationSize 	..	Size of the destination. If the record doesn't fit, it is kept.
+					 * @param size            	..	Receives the payload size of the record. May be NULL!
+					 * @return                	..	Returns if the operation was successful, i.e. false if there were no records or
+					 *                        	  	the record didn't fit into the destination.
+					 */
+					bool read( void *destination, size_t destinationSize, TLength *size = nullptr ) {
+						TLength payloadSize;
+						const uint8_t *payload = peek( &payloadSize );
+						if ( payload == nullptr  ||  payloadSize > destinationSize )  return false;
+						memcpy( destination, payload, payloadSize );
+						if ( size )  *size = payloadSize;
+						return release();
+					}
+
+
+				private:
+					inline TLength getHeader( index_t index ) const {
+						TLength header;
+						memcpy( &header, &m_bytes[index], HeaderSize );
+						return header;
+					}
+
+					inline void setHeader( index_t index, TLength header ) {
+						memcpy( &m_bytes[index], &header, HeaderSize );
+					}
+
+					/// Returns the byte index of the oldest record, skipping the end of the buffer if the producer wrapped around.
+					index_t oldestRecordIndex() const {
+						const index_t readIndex = m_readIndex.load(std::memory_order_relaxed);
+						const index_t writeIndex = m_writeIndex.load(std::memory_order_acquire);
+						if ( readIndex == writeIndex )  return NoRecord;
+						if ( TByteCapacity - readIndex < HeaderSize  ||  getHeader(readIndex) == WrapMarker ) {
+							return (writeIndex == 0)  ?  NoRecord  :  0;
+						}
+						return readIndex;
+					}
+
+
+				private:
+					alignas(TLength) uint8_t m_bytes[TByteCapacity];                 	///< Contains all records.
+					index_t                  m_reservedIndex;                        	///< Where the reserved record starts; NoRecord if there is no reservation. Producer only.
+					TLength                  m_reservedSize;                         	///< Producer only.
+					alignas(IndexAlignment) std::atomic<index_t> m_readIndex;        	///< Start of the oldest record (or skipped end of the buffer). Written by consumer only.
+					alignas(IndexAlignment) std::atomic<index_t> m_writeIndex;       	///< End of the newest record. Written by producer only.
+
+			}; /* class */
+
+		} /*namespace StaticMemory*/
+	} /* namespace Lists */
+} /* namespace Util */
+
+#endif /* APPLICATION_USER_LISTS_STATICMEMORY_RECORDFIFO_H_ */
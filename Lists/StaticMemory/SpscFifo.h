@@ -0,0 +1,182 @@
+/*
+ * SpscFifo.h
+ *
+ *  Created on: 16.10.2026
+ *      Author: agent
+ *
+ *  Description:
+ *    This class contains a lock-free circular buffer for POD value types, for exactly one producer and one consumer
+ *    (e.g. ISR and main loop, or two threads).
+ *
+ *    Further information:
+ *      - no usage of dynamic memory,
+ *      - no Mutex necessary: Interrupts never get disabled. The producer only writes the write index, the consumer
+ *        only writes the read index. Both are published using release/acquire semantics,
+ *      - only enqueue() may be called by the producer; dequeue(), peek() and clear() may be called by the consumer,
+ *      - overwriting the oldest element is not supported, since that would require the producer to modify the read index.
+ */
+#ifndef APPLICATION_USER_LISTS_STATICMEMORY_SPSCFIFO_H_
+#define APPLICATION_USER_LISTS_STATICMEMORY_SPSCFIFO_H_
+
+
+#include <stdint-gcc.h>
+#include <stddef.h>
+#include <array>
+#include <atomic>
+#include <type_traits>
+
+namespace Util {
+	namespace Lists {
+		namespace StaticMemory {
+
+			template <typename T, uint_fast16_t TArraySize = 15>
+			class SpscFifo {
+				static_assert( std::is_pod<T>::value, "T must be Plain-Old-Data!" );
+				static_assert( TArraySize > 0  &&  TArraySize < UINT16_MAX, "TArraySize must be within range [1 .. 65534]!" );
+
+				private:
+					using index_t = uint_fast16_t;
+
+					/// One slot always stays unused. Thereby 'full' and 'empty' can be told apart without a shared element counter.
+					static constexpr index_t SlotCount = TArraySize + 1;
+
+					/// On hosts, both indices are put into separate cache lines to prevent false sharing between producer and consumer.
+					#if defined(__x86_64__) || defined(__i386__) || defined(__aarch64__)
+						static constexpr size_t IndexAlignment = 64;
+					#else
+						static constexpr size_t IndexAlignment = alignof(std::atomic<index_t>);
+					#endif
+
+					static inline index_t nextIndex(index_t index) {
+						index++;  if ( index >= SlotCount )  index = 0;
+						return index;
+					}
+
+				public:
+
+					SpscFifo() : m_nextReadIndex(0), m_nextWriteIndex(0) {}
+
+					/**
+					 * Returns if the circular buffer is empty.
+					 *
+					 * @remark If called by the producer, the result may be outdated already.
+					 */
+					inline bool isEmpty(void) const {
+						return m_nextReadIndex.load(std::memory_order_acquire) == m_nextWriteIndex.load(std::memory_order_acquire);
+					}
+
+					/**
+					 * Returns if the circular buffer is full.
+					 *
+					 * @remark If called by the consumer, the result may be outdated already.
+					 */
+					inline bool isFull(void) const {
+						return nextIndex( m_nextWriteIndex.load(std::memory_order_acquire) ) == m_nextReadIndex.load(std::memory_order_acquire);
+					}
+
+					/**
+					 * Returns the maximum size of the circular buffer.
+					 */
+					inline uint_fast16_t size() const {
+						return TArraySize;
+					}
+
+					/**
+					 * Returns the number of present elements.
+					 *
+					 * @remark Since producer and consumer run concurrently, the result is a snapshot only.
+					 */
+					inline uint_fast16_t Count() const {
+						const index_t readIndex = m_nextReadIndex.load(std::memory_order_acquire);
+						const index_t writeIndex = m_nextWriteIndex.load(std::memory_order_acquire);
+						return (writeIndex >= readIndex)  ?  writeIndex - readIndex  :  SlotCount - readIndex + writeIndex;
+					}
+
+					/**
+					 * Returns the number of free element slots.
+					 *
+					 * @remark Since producer and consumer run concurrently, the result is a snapshot only.
+					 */
+					inline uint_fast16_t freeElementCount() const {
+						return TArraySize - Count();
+					}
+
+					/**
+					 * Clears the circular buffer. Must only be called by the consumer.
+					 */
+					void clear(void) {
+						m_nextReadIndex.store( m_nextWriteIndex.load(std::memory_order_acquire), std::memory_order_release );
+					}
+
+					/**
+					 * Applies (copies) one element to the circular buffer. Must only be called by the producer.
+					 *
+					 * @remark In case the circular buffer is full, the element won't be copied.
+					 *
+					 * @param copyFromElement 	..	The element that will be applied.
+					 * @return                	..	Returns if the operation was successful.
+					 */
+					bool enqueue( const T& copyFromElement ) {
+						const index_t writeIndex = m_nextWriteIndex.load(std::memory_order_relaxed);
+						const index_t nextWriteIndex = nextIndex( writeIndex );
+						if ( nextWriteIndex == m_nextReadIndex.load(std::memory_order_acquire) )  {
+							return false;
+						}
+						m_elementArray[writeIndex] = copyFromElement;
+						m_nextWriteIndex.store( nextWriteIndex, std::memory_order_release );  // Publishes the element to the consumer
+						return true;
+					}
+
+					/**
+					 * Fetches the oldest element and removes it from circular buffer. Must only be called by the consumer.
+					 *
+					 * @param copyDestination 	..	Holds the destination the element should be copied to. May be NULL!
+					 * @return                	..	Returns if the operation was successful.
+					 *                    	      	  true:  The operation was successful.
+					 *                    	      	  false: The circular buffer was empty; operation not successful.
+					 */
+					bool dequeue( T *copyDestination ) {
+						const index_t readIndex = m_nextReadIndex.load(std::memory_order_relaxed);
+						if ( readIndex == m_nextWriteIndex.load(std::memory_order_acquire) )  {
+							return false;
+						}
+						if (copyDestination)  *copyDestination = m_elementArray[readIndex];
+						m_nextReadIndex.store( nextIndex(readIndex), std::memory_order_release );  // Hands the slot back to the producer
+						return true;
+					}
+
+					/**
+					 * Discards the oldest element. Must only be called by the consumer.
+					 */
+					void dequeue(void) {
+						dequeue(nullptr);
+					}
+
+					/**
+					 * Returns a pointer to the oldest element, without removing it from buffer. Must only be called by the consumer.
+					 *
+					 * @remark The element stays valid until it gets dequeued.
+					 *
+					 * @return	..	Pointer to the oldest element. Will be NULL if the circular buffer is empty.
+					 */
+					T* peek() {
+						const index_t readIndex = m_nextReadIndex.load(std::memory_order_relaxed);
+						if ( readIndex == m_nextWriteIndex.load(std::memory_order_acquire) )  {
+							return 0;
+						}
+						return &m_elementArray[readIndex];
+					}
+
+
+				private:
+					std::array<T, SlotCount> m_elementArray;                      	///< Contains all elements.
+					alignas(IndexAlignment) std::atomic<index_t> m_nextReadIndex; 	///< Always points to the field containing the oldest element. Written by consumer only.
+					alignas(IndexAlignment) std::atomic<index_t> m_nextWriteIndex;	///< Always points to the next free field. Written by producer only.
+
+			}; /* class */
+
+		} /*namespace StaticMemory*/
+	} /* namespace Lists */
+} /* namespace Util */
+
+#endif /* APPLICATION_USER_LISTS_STATICMEMORY_SPSCFIFO_H_ */
@@ -0,0 +1,99 @@
+/*
+ * FifoBenchmark.cpp
+ *
+ *  Created on: 16.10.2026
+ *      Author: agent
+ *
+ *  Description:
+ *  	Throughput benchmark of the circular buffer, compared to the former implementation (8 bit indices,
+ *  	element counter and compare-and-reset wraparound). Intended to be run on the (Linux) host.
+ */
+
+#include "../Fifo.h"
+#include "FifoBenchmark.h"
+
+#include <chrono>
+#include <stdio.h>
+
+
+namespace Util {
+	namespace Lists {
+		namespace StaticMemory {
+
+			namespace {
+				constexpr uint32_t ElementCount = 20000000;
+
+				/// The former Fifo implementation (reduced to enqueue/dequeue), serving as reference.
+				template <typename T, uint_fast8_t TArraySize>
+				class LegacyFifo {
+					public:
+						LegacyFifo() {
+							m_nextReadIndex = m_nextWriteIndex = m_elementCount = 0;
+						}
+
+						bool enqueue( const T& copyFromElement ) {
+							if ( m_elementCount >= TArraySize )  {
+								return false;
+							}
+							m_elementArray[m_nextWriteIndex] = copyFromElement;
+							m_nextWriteIndex++;     if ( m_nextWriteIndex >= TArraySize )  m_nextWriteIndex = 0;
+							m_elementCount++;
+							return true;
+						}
+
+						bool dequeue( T *copyDestination ) {
+							if ( m_elementCount == 0 )  {
+								return false;
+							}
+							if (copyDestination)  *copyDestination = m_elementArray[m_nextReadIndex];
+							m_nextReadIndex++;  if ( m_nextReadIndex >= TArraySize )  m_nextReadIndex = 0;
+							m_elementCount--;
+							return true;
+						}
+
+					private:
+						std::array<T, TArraySize> m_elementArray;
+						volatile uint_fast8_t m_nextReadIndex;
+						volatile uint_fast8_t m_nextWriteIndex;
+						volatile uint_fast8_t m_elementCount;
+				};
+
+				LegacyFifo<uint32_t, 255>   LegacyFifo255;
+				Fifo<uint32_t, false, 255>  Fifo255;
+				Fifo<uint32_t, false, 256>  Fifo256;
+				Fifo<uint32_t, false, 4000> Fifo4000;
+				Fifo<uint32_t, false, 4096> Fifo4096;
+			}
+
+
+			template <typename TFifo>
+			double FifoBenchmark::measureMegaElementsPerSecond( TFifo &fifo, size_t burstLength ) {
+				uint32_t sum = 0, value = 0;
+				const auto start = std::chrono::steady_clock::now();
+				for (uint32_t elementNum = 0; elementNum < ElementCount; elementNum += burstLength) {
+					for (size_t i = 0; i<burstLength; i++)  fifo.enqueue( elementNum + i );
+					for (size_t i = 0; i<burstLength; i++)  { fifo.dequeue( &value );  sum += value; }
+				}
+				const std::chrono::duration<double> duration = std::chrono::steady_clock::now() - start;
+
+				volatile uint32_t sink = sum;
+				(void)sink;
+				return ElementCount / duration.count() / 1e6;
+			}
+
+			void FifoBenchmark::performAllBenchmarks() {
+				const size_t burstLengths[] = { 1, 64, 250 };
+
+				printf( "Fifo enqueue+dequeue throughput (%u elements, burst = elements enqueued before dequeuing them):\n", static_cast<unsigned>(ElementCount) );
+				printf( "  burst   former (255) [M/s]   Fifo 255 [M/s]   Fifo 256 [M/s]   Fifo 4000 [M/s]   Fifo 4096 [M/s]\n" );
+				for (size_t burstLength : burstLengths) {
+					printf( "  %5u   %18.1f   %14.1f   %14.1f   %15.1f   %15.1f\n", static_cast<unsigned>(burstLength),
+							measureMegaElementsPerSecond(LegacyFifo255, burstLength), measureMegaElementsPerSecond(Fifo255, burstLength),
+							measureMegaElementsPerSecond(Fifo256, burstLength), measureMegaElementsPerSecond(Fifo4000, burstLength),
+							measureMegaElementsPerSecond(Fifo4096, burstLength) );
+				}
+			}
+
+		} /* namespace StaticMemory */
+	} /* namespace Lists */
+} /* namespace Util */
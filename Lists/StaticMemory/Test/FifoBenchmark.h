@@ -0,0 +1,41 @@
+/*
+ * FifoBenchmark.h
+ *
+ *  Created on: 16.10.2026
+ *      Author: agent
+ *
+ *  Description:
+ *  	Throughput benchmark of the circular buffer, compared to the former implementation (8 bit indices,
+ *  	element counter and compare-and-reset wraparound). Intended to be run on the (Linux) host.
+ */
+
+#ifndef UTIL_LISTS_STATICMEMORY_TEST_FIFO_BENCHMARK_H_
+#define UTIL_LISTS_STATICMEMORY_TEST_FIFO_BENCHMARK_H_
+
+#include <stdint-gcc.h>
+#include <stddef.h>
+
+
+namespace Util {
+	namespace Lists {
+		namespace StaticMemory {
+
+			class FifoBenchmark {
+					FifoBenchmark() = delete;
+
+				public:
+					/**
+					 * Runs all benchmarks and prints the results to stdout.
+					 */
+					static void performAllBenchmarks();
+
+				private:
+					template <typename TFifo>
+					static double measureMegaElementsPerSecond( TFifo &fifo, size_t burstLength );
+			};
+
+		} /* namespace StaticMemory */
+	} /* namespace Lists */
+} /* namespace Util */
+
+#endif /* UTIL_LISTS_STATICMEMORY_TEST_FIFO_BENCHMARK_H_ */
@@ -0,0 +1,467 @@
+/*
+ * FifoTest.cpp
+ *
+ *  Created on: 16.10.2026
+ *      Author: agent
+ *
+ *  Description:
+ *  	Tests for circular buffer.
+ */
+
+#include "../Fifo.h"
+#include "FifoTest.h"
+
+#include <algorithm>
+#include <numeric>
+
+
+namespace Util {
+	namespace Lists {
+		namespace StaticMemory {
+
+			namespace {
+				/// Move-only element type, which keeps track of the number of living instances. Moving from the most recently
+				/// destroyed instance yields the value 0.
+				class TrackedElement {
+					public:
+						static int32_t LivingInstances;
+						static const TrackedElement *DestroyedInstance;
+
+						explicit TrackedElement( uint32_t value = 0 ) : m_value(value)  { constructed(); }
+						TrackedElement( TrackedElement &&other ) : m_value( (&other == DestroyedInstance) ? 0 : other.m_value )  { other.m_value = 0;  constructed(); }
+						TrackedElement& operator=( TrackedElement &&other )  { m_value = other.m_value;  other.m_value = 0;  return *this; }
+						TrackedElement( const TrackedElement& ) = delete;
+						~TrackedElement()  { LivingInstances--;  DestroyedInstance = this; }
+
+						uint32_t value() const  { return m_value; }
+
+					private:
+						void constructed() {
+							LivingInstances++;
+							if ( this == DestroyedInstance )  DestroyedInstance = nullptr;
+						}
+
+						uint32_t m_value;
+				};
+				int32_t TrackedElement::LivingInstances = 0;
+				const TrackedElement *TrackedElement::DestroyedInstance = nullptr;
+
+				/// Copyable element type, which keeps track of the number of living instances.
+				class CopyableElement {
+					public:
+						static int32_t LivingInstances;
+
+						explicit CopyableElement( uint32_t value = 0 ) : m_value(value)  { LivingInstances++; }
+						CopyableElement( const CopyableElement &other ) : m_value(other.m_value)  { LivingInstances++; }
+						CopyableElement& operator=( const CopyableElement& ) = default;
+						~CopyableElement()  { LivingInstances--; }
+
+						uint32_t value() const  { return m_value; }
+
+					private:
+						uint32_t m_value;
+				};
+				int32_t CopyableElement::LivingInstances = 0;
+
+				/// Cycle counter which is advanced manually by the test.
+				struct ManualCycleCounter {
+					using value_type = uint16_t;
+					static value_type Now;
+					static value_type now()  { return Now; }
+				};
+				ManualCycleCounter::value_type ManualCycleCounter::Now = 0;
+
+				/// Lock policy which counts how often it gets locked and unlocked.
+				class CountingMutex {
+					public:
+						static uint32_t LockCount, UnlockCount;
+
+						static void lock()      { LockCount++; }
+						static void unlock()    { UnlockCount++; }
+						static bool try_lock()  { lock();  return true; }
+				};
+				uint32_t CountingMutex::LockCount = 0, CountingMutex::UnlockCount = 0;
+			}
+
+
+			void FifoTest::assertTrue( bool value ) {
+				if ( !value )  while(1){}
+			}
+
+			void FifoTest::assertEquals( uint32_t expected, uint32_t value ) {
+				if ( expected != value )  while(1){}
+			}
+
+
+			void FifoTest::performAllTests() {
+				performTest_BulkTransfer();
+				performTest_BulkOverwrite();
+				performTest_LargeBulkCounts();
+				performTest_ZeroCopyRegions();
+				performTest_LargeCapacity();
+				performTest_IndexedAccessAndIterators();
+				performTest_NonPodElements();
+				performTest_Copy();
+				performTest_Statistics();
+				performTest_LockedAccess();
+			}
+
+			void FifoTest::performTest_BulkTransfer() {
+				Fifo<uint32_t, false, 5> fifo;
+				const uint32_t input[] = { 1, 2, 3, 4, 5, 6, 7 };
+				uint32_t output[7] = {};
+
+				assertEquals( 0, fifo.dequeueBulk(output, 7) );
+				assertEquals( 3, fifo.enqueueBulk(input, 3) );
+				assertEquals( 2, fifo.dequeueBulk(output, 2) );
+				assertEquals( 1, output[0] );  assertEquals( 2, output[1] );
+
+				// Write index is at 3 now, so the following elements wrap around. Only 4 slots are free.
+				assertEquals( 4, fifo.enqueueBulk(&input[3], 4) );
+				assertTrue( fifo.isFull() );
+				assertEquals( 0, fifo.enqueueBulk(input, 1) );
+
+				assertEquals( 5, fifo.dequeueBulk(output, 7) );
+				for (uint32_t i = 0; i<5; i++)  assertEquals( 3 + i, output[i] );
+				assertTrue( fifo.isEmpty() );
+
+				// Discarding elements
+				fifo.enqueueBulk( input, 4 );
+				assertEquals( 3, fifo.dequeueBulk(nullptr, 3) );
+				assertTrue( fifo.dequeue(&output[0]) );
+				assertEquals( 4, output[0] );
+			}
+
+			void FifoTest::performTest_BulkOverwrite() {
+				Fifo<uint32_t, true, 5> fifo;
+				const uint32_t input[] = { 1, 2, 3, 4, 5, 6, 7, 8 };
+				uint32_t output[8] = {};
+
+				fifo.enqueueBulk( input, 4 );
+				assertEquals( 3, fifo.enqueueBulk(&input[4], 3) );  // --> Overwrites elements 1 and 2
+				assertEquals( 5, fifo.Count() );
+				assertEquals( 5, fifo.dequeueBulk(output, 8) );
+				for (uint32_t i = 0; i<5; i++)  assertEquals( 3 + i, output[i] );
+
+				fifo.enqueue( 100 );
+				assertEquals( 5, fifo.enqueueBulk(input, 8) );  // --> Only the last five elements remain
+				assertEquals( 5, fifo.dequeueBulk(output, 8) );
+				for (uint32_t i = 0; i<5; i++)  assertEquals( 4 + i, output[i] );
+			}
+
+			/**
+			 * Element counts beyond the range of the Fifo's (8 bit) indices must not get truncated.
+			 */
+			void FifoTest::performTest_LargeBulkCounts() {
+				static uint8_t input[300], output[300];
+				for (uint32_t i = 0; i<300; i++)  input[i] = static_cast<uint8_t>( i );
+				size_t elementCount = 300;
+
+				Fifo<uint8_t, false, 64> fifo;
+				static_assert( sizeof(Fifo<uint8_t, false, 64>::size_type) == 1, "The test requires 8 bit indices!" );
+				assertEquals( 64, fifo.enqueueBulk(input, elementCount) );
+				assertEquals( 64, fifo.dequeueBulk(output, elementCount) );
+				assertEquals( 63, output[63] );
+				assertEquals( 0, fifo.dequeueBulk(output, elementCount) );
+
+				Fifo<uint8_t, true, 64> overwritingFifo;
+				elementCount = 256;
+				assertEquals( 64, overwritingFifo.enqueueBulk(input, elementCount) );  // --> Only the last 64 elements remain
+				assertEquals( 64, overwritingFifo.lock().dequeueBulk(output, elementCount) );
+				assertEquals( 256 - 64, output[0] );
+				assertEquals( 255, output[63] );
+
+				// Zero-copy regions
+				Fifo<uint8_t, false, 64>::size_type count = 0;
+				uint8_t *region = fifo.reserveWrite( elementCount, &count );
+				assertTrue( region != nullptr );
+				assertEquals( 64, count );
+				fifo.commitWrite( elementCount );
+				assertTrue( fifo.isFull() );
+				assertEquals( 64, fifo.lock().release(elementCount) );
+				assertTrue( fifo.isEmpty() );
+			}
+
+			void FifoTest::performTest_ZeroCopyRegions() {
+				Fifo<uint32_t, false, 5> fifo;
+				Fifo<uint32_t, false, 5>::size_type count = 0;
+
+				assertTrue( fifo.peekRead(&count) == nullptr );
+				assertEquals( 0, count );
+
+				uint32_t *region = fifo.reserveWrite( 3, &count );
+				assertTrue( region != nullptr );
+				assertEquals( 3, count );
+				region[0] = 1;  region[1] = 2;
+				fifo.commitWrite( 2 );
+				assertEquals( 2, fifo.Count() );
+
+				region = fifo.peekRead( &count );
+				assertEquals( 2, count );
+				assertEquals( 1, region[0] );  assertEquals( 2, region[1] );
+				assertEquals( 2, fifo.release(5) );
+				assertTrue( fifo.isEmpty() );
+
+				// Write index is at 2 now; the region ends at the end of the array.
+				region = fifo.reserveWrite( 5, &count );
+				assertEquals( 3, count );
+				region[0] = 3;  region[1] = 4;  region[2] = 5;
+				fifo.commitWrite( 3 );
+				region = fifo.reserveWrite( 5, &count );
+				assertEquals( 2, count );
+				region[0] = 6;  region[1] = 7;
+				fifo.commitWrite( 2 );
+				assertTrue( fifo.isFull() );
+				assertTrue( fifo.reserveWrite(1, &count) == nullptr );
+				assertEquals( 0, count );
+
+				region = fifo.peekRead( &count );
+				assertEquals( 3, count );
+				assertEquals( 3, region[0] );
+				fifo.release( count );
+				region = fifo.peekRead( &count );
+				assertEquals( 2, count );
+				assertEquals( 6, region[0] );  assertEquals( 7, region[1] );
+			}
+
+			void FifoTest::performTest_LargeCapacity() {
+				static_assert( sizeof(Fifo<uint32_t, false, 255>::size_type) == 2, "Positions of 255 elements wrap at 510!" );
+				static_assert( sizeof(Fifo<uint32_t, false, 128>::size_type) == 1, "Free-running positions fit 8 bits!" );
+				static_assert( sizeof(Fifo<uint32_t, false, 4096>::size_type) == 2, "" );
+
+				static Fifo<uint32_t, false, 1000> fifo;
+				static Fifo<uint32_t, true, 4096> overwritingFifo;
+				uint32_t value = 0;
+
+				// Several rounds, so that the positions wrap around multiple times
+				for (uint32_t round = 0; round<3; round++) {
+					for (uint32_t i = 0; i<1000; i++)  assertTrue( fifo.enqueue(i) );
+					assertTrue( fifo.isFull() );
+					assertTrue( !fifo.enqueue(0) );
+					assertEquals( 999, *fifo.peek(999) );
+					for (uint32_t i = 0; i<1000; i++) {
+						assertTrue( fifo.dequeue(&value) );
+						assertEquals( i, value );
+					}
+					assertTrue( fifo.isEmpty() );
+				}
+
+				for (uint32_t i = 0; i<5*4096 + 7; i++)  overwritingFifo.enqueue( i );
+				assertEquals( 4096, overwritingFifo.Count() );
+				for (uint32_t i = 0; i<4096; i++) {
+					assertTrue( overwritingFifo.dequeue(&value) );
+					assertEquals( 4*4096 + 7 + i, value );
+				}
+				assertTrue( overwritingFifo.isEmpty() );
+			}
+
+			void FifoTest::performTest_IndexedAccessAndIterators() {
+				Fifo<uint32_t, true, 6> fifo;
+				const Fifo<uint32_t, true, 6> &constFifo = fifo;
+
+				assertTrue( fifo.begin() == fifo.end() );
+				for (uint32_t i = 1; i<=9; i++)  fifo.enqueue( i );  // --> Contains 4..9, wrapped around
+
+				for (uint32_t i = 0; i<6; i++) {
+					assertEquals( 4 + i, *fifo.peek(i) );
+					assertEquals( 4 + i, fifo[i] );
+				}
+				assertTrue( fifo.peek(6) == nullptr );
+
+				uint32_t expected = 4;
+				for (uint32_t value : constFifo)  assertEquals( expected++, value );
+				assertEquals( 10, expected );
+
+				assertEquals( 6, static_cast<uint32_t>(fifo.end() - fifo.begin()) );
+				assertEquals( 4+5+6+7+8+9, std::accumulate(constFifo.begin(), constFifo.end(), UINT32_C(0)) );
+				assertEquals( 2, static_cast<uint32_t>(std::find(fifo.cbegin(), fifo.cend(), 6) - fifo.cbegin()) );
+				assertEquals( 9, fifo.begin()[5] );
+
+				std::reverse( fifo.begin(), fifo.end() );
+				assertEquals( 9, *fifo.peek() );
+				std::sort( fifo.begin(), fifo.end() );
+				assertTrue( std::is_sorted(constFifo.begin(), constFifo.end()) );
+				assertEquals( 4, *fifo.peek() );
+
+				uint32_t sum = 0;
+				fifo.forEach( [&sum](uint32_t &value) { sum += value;  value = 0; } );
+				assertEquals( 4+5+6+7+8+9, sum );
+				constFifo.forEach( [](const uint32_t &value) { if ( value != 0 )  while(1){} } );
+			}
+
+			void FifoTest::performTest_NonPodElements() {
+				{
+					Fifo<TrackedElement, false, 3> fifo;
+					TrackedElement element;
+					assertEquals( 1, TrackedElement::LivingInstances );
+
+					assertTrue( fifo.emplace(1) );
+					assertTrue( fifo.enqueue(TrackedElement(2)) );
+					assertTrue( fifo.emplace(3) );
+					assertTrue( !fifo.emplace(4) );
+					assertEquals( 4, TrackedElement::LivingInstances );
+
+					assertTrue( fifo.dequeue(&element) );  // --> Moved out and destroyed within the buffer
+					assertEquals( 1, element.value() );
+					assertEquals( 3, TrackedElement::LivingInstances );
+					assertEquals( 2, fifo.peek()->value() );
+
+					fifo.dequeue();
+					assertEquals( 2, TrackedElement::LivingInstances );
+					fifo.emplace( 5 );
+					fifo.clear();
+					assertEquals( 1, TrackedElement::LivingInstances );
+
+					fifo.emplace( 6 );
+					fifo.emplace( 7 );
+				}
+				assertEquals( 0, TrackedElement::LivingInstances );  // --> Remaining elements were destroyed along with the buffer
+
+				Fifo<TrackedElement, true, 2> overwritingFifo;
+				TrackedElement elements[2];
+				for (uint32_t i = 1; i<=5; i++)  overwritingFifo.emplace( i );
+				assertEquals( 4, TrackedElement::LivingInstances );
+				assertEquals( 2, overwritingFifo.dequeueBulk(elements, 2) );
+				assertEquals( 4, elements[0].value() );
+				assertEquals( 5, elements[1].value() );
+				assertEquals( 2, TrackedElement::LivingInstances );
+
+				// The new element may be built from the one it overwrites
+				overwritingFifo.emplace( 6 );
+				overwritingFifo.emplace( 7 );
+				assertTrue( overwritingFifo.enqueue(std::move(*overwritingFifo.peek())) );
+				assertEquals( 7, overwritingFifo.peek()->value() );
+				assertEquals( 6, overwritingFifo.peek(1)->value() );
+				assertEquals( 4, TrackedElement::LivingInstances );
+			}
+
+			void FifoTest::performTest_Copy() {
+				// Wrapped around the end of the array
+				Fifo<uint32_t, false, 5, Util::Mutex::NoMutex, FifoStatistics<>> fifo;
+				for (uint32_t i = 1; i<=5; i++)  fifo.enqueue( i );
+				for (uint32_t i = 0; i<3; i++)  fifo.dequeue();
+				fifo.enqueue( 6 );
+				fifo.enqueue( 7 );
+
+				Fifo<uint32_t, false, 5, Util::Mutex::NoMutex, FifoStatistics<>> copy( fifo );
+				assertEquals( 4, copy.Count() );
+				assertTrue( std::equal(fifo.begin(), fifo.end(), copy.begin()) );
+				assertEquals( 5, copy.statistics().peakCount() );
+				copy.dequeue();
+				assertEquals( 4, fifo.Count() );
+				assertEquals( 4, *fifo.peek() );
+
+				// Non-trivially copyable elements get copy-constructed
+				{
+					Fifo<CopyableElement, true, 3> original;
+					for (uint32_t i = 1; i<=4; i++)  original.emplace( i );
+					assertEquals( 3, CopyableElement::LivingInstances );
+
+					Fifo<CopyableElement, true, 3> copied( original );
+					assertEquals( 6, CopyableElement::LivingInstances );
+					assertEquals( 2, copied[0].value() );
+					assertEquals( 4, copied[2].value() );
+
+					Fifo<CopyableElement, true, 3> assigned;
+					assigned.emplace( 9 );
+					assigned = original;
+					assertEquals( 9, CopyableElement::LivingInstances );
+					assertEquals( 3, assigned[1].value() );
+					assigned = assigned;
+					assertEquals( 9, CopyableElement::LivingInstances );
+					assertEquals( 3, assigned.Count() );
+				}
+				assertEquals( 0, CopyableElement::LivingInstances );
+			}
+
+
+			void FifoTest::performTest_Statistics() {
+				static_assert( sizeof(Fifo<uint32_t, false, 8>) == sizeof(Fifo<uint32_t, false, 8, Util::Mutex::NoMutex, NoFifoStatistics>), "" );
+				static_assert( sizeof(Fifo<uint8_t, false, 8>) == 8 + 2, "Disabled statistics must not occupy memory!" );
+
+				// Counters
+				Fifo<uint32_t, false, 4, Util::Mutex::NoMutex, FifoStatistics<>> fifo;
+				const uint32_t input[] = { 1, 2, 3, 4, 5, 6 };
+				assertEquals( 3, fifo.enqueueBulk(input, 3) );
+				fifo.dequeue();
+				assertEquals( 3, fifo.statistics().peakCount() );
+				assertEquals( 2, fifo.enqueueBulk(input, 6) );  // --> Four elements are rejected
+				assertTrue( !fifo.enqueue(7) );
+				fifo.release( 4 );
+				uint32_t *region = fifo.reserveWrite( 4 );
+				region[0] = 8;
+				fifo.commitWrite( 1 );
+				assertEquals( 4, fifo.statistics().peakCount() );
+				assertEquals( 5, fifo.statistics().rejectedCount() );
+				assertEquals( 0, fifo.statistics().overwrittenCount() );
+
+				fifo.resetStatistics();
+				assertEquals( 0, fifo.statistics().peakCount() );
+				assertEquals( 0, fifo.statistics().rejectedCount() );
+
+				Fifo<uint32_t, true, 4, Util::Mutex::NoMutex, FifoStatistics<>> overwritingFifo;
+				for (uint32_t i = 0; i<6; i++)  overwritingFifo.enqueue( i );
+				assertEquals( 2, overwritingFifo.statistics().overwrittenCount() );
+				overwritingFifo.dequeueBulk( nullptr, 3 );
+				assertEquals( 4, overwritingFifo.enqueueBulk(input, 6) );  // --> The remaining stored element plus the first two given ones get lost
+				assertEquals( 5, overwritingFifo.statistics().overwrittenCount() );
+				assertEquals( 4, overwritingFifo.statistics().peakCount() );
+				assertEquals( 0, overwritingFifo.statistics().rejectedCount() );
+
+				// Residence times; the slots wrap around the end of the array
+				Fifo<uint32_t, false, 3, Util::Mutex::NoMutex, FifoStatistics<ManualCycleCounter>> timedFifo;
+				ManualCycleCounter::Now = 65530;
+				timedFifo.enqueue( 1 );
+				timedFifo.enqueue( 2 );
+				ManualCycleCounter::Now += 10;  // --> The counter wraps around
+				timedFifo.dequeue();
+				assertEquals( 1, timedFifo.statistics().measurementCount() );
+				assertEquals( 10, timedFifo.statistics().minResidenceTime() );
+				assertEquals( 2, timedFifo.enqueueBulk(input, 2) );
+				ManualCycleCounter::Now += 20;
+				assertEquals( 3, timedFifo.dequeueBulk(nullptr, 3) );  // --> Residence times 30, 20 and 20
+				assertEquals( 4, timedFifo.statistics().measurementCount() );
+				assertEquals( 10, timedFifo.statistics().minResidenceTime() );
+				assertEquals( 30, timedFifo.statistics().maxResidenceTime() );
+				assertEquals( 20, timedFifo.statistics().averageResidenceTime() );
+				assertEquals( 20, timedFifo.lock().statistics().averageResidenceTime() );
+				assertEquals( 3, timedFifo.statistics().peakCount() );
+			}
+
+
+			void FifoTest::performTest_LockedAccess() {
+				using LockedFifo = Fifo<uint32_t, false, 4, CountingMutex>;
+				LockedFifo fifo;
+				uint32_t value = 0;
+
+				fifo.enqueue( 1 );
+				assertEquals( 1, CountingMutex::LockCount );
+				{
+					auto locked = fifo.lock();
+					assertEquals( 2, CountingMutex::LockCount );
+					locked.enqueue( 2 );
+					locked.emplace( 3 );
+					if ( locked.peek()  &&  *locked.peek() == 1 )  locked.dequeue( &value );
+					assertEquals( 1, value );
+					assertEquals( 2, locked.Count() );
+
+					uint32_t sum = 0;
+					for (uint32_t element : locked)  sum += element;
+					assertEquals( 5, sum );
+
+					LockedFifo::Locked movedGuard( std::move(locked) );  // --> Still one locked section
+					assertEquals( 1, movedGuard.release(1) );
+					assertEquals( 2, CountingMutex::LockCount );
+					assertEquals( 1, CountingMutex::UnlockCount );
+				}
+				assertEquals( 2, CountingMutex::LockCount );
+				assertEquals( 2, CountingMutex::UnlockCount );  // --> Unlocked exactly once
+
+				assertTrue( fifo.dequeue(&value) );
+				assertEquals( 3, value );
+				assertEquals( 3, CountingMutex::UnlockCount );
+			}
+
+		} /* namespace StaticMemory */
+	} /* namespace Lists */
+} /* namespace Util */
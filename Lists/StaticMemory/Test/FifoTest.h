@@ -0,0 +1,48 @@
+/*
+ * FifoTest.h
+ *
+ *  Created on: 16.10.2026
+ *      Author: agent
+ *
+ *  Description:
+ *  	Tests for circular buffer.
+ */
+
+#ifndef UTIL_LISTS_STATICMEMORY_TEST_FIFO_TEST_H_
+#define UTIL_LISTS_STATICMEMORY_TEST_FIFO_TEST_H_
+
+#include <stdint-gcc.h>
+
+
+namespace Util {
+	namespace Lists {
+		namespace StaticMemory {
+
+			class FifoTest {
+					FifoTest() = delete;
+
+				public:
+					static void performAllTests();
+
+				private:
+					static void assertTrue( bool value );
+					static void assertEquals( uint32_t expected, uint32_t value );
+
+					static void performTest_BulkTransfer();
+					static void performTest_BulkOverwrite();
+					static void performTest_LargeBulkCounts();
+					static void performTest_ZeroCopyRegions();
+					static void performTest_LargeCapacity();
+					static void performTest_IndexedAccessAndIterators();
+					static void performTest_NonPodElements();
+					static void performTest_Copy();
+					static void performTest_Statistics();
+					static void performTest_LockedAccess();
+
+			};
+
+		} /* namespace StaticMemory */
+	} /* namespace Lists */
+} /* namespace Util */
+
+#endif /* UTIL_LISTS_STATICMEMORY_TEST_FIFO_TEST_H_ */
@@ -0,0 +1,95 @@
+/*
+ * HashMapBenchmark.cpp
+ *
+ *  Created on: 16.10.2026
+ *      Author: agent
+ *
+ *  Description:
+ *  	Lookup benchmark of the Robin Hood hash map, compared to the linear search over an array of registered
+ *  	IDs it replaces. Intended to be run on the (Linux) host.
+ */
+
+#include "../HashMap.h"
+#include "HashMapBenchmark.h"
+
+#include <array>
+#include <chrono>
+#include <stdio.h>
+
+
+namespace Util {
+	namespace Lists {
+		namespace StaticMemory {
+
+			namespace {
+				constexpr uint32_t LookupCount = 20000000;
+
+				uint32_t nextPseudoRandom( uint32_t &state ) {
+					state ^= state << 13;  state ^= state >> 17;  state ^= state << 5;
+					return state;
+				}
+
+				/// Registry as used so far: IDs and values in arrays, looked up by linear search.
+				template <size_t TElementCount>
+				struct LinearRegistry {
+					std::array<uint32_t, TElementCount> ids;
+					std::array<uint32_t, TElementCount> values;
+					size_t count = 0;
+
+					void insert( uint32_t id, uint32_t value )  { ids[count] = id;  values[count] = value;  count++; }
+					const uint32_t* find( uint32_t id ) const {
+						for (size_t i = 0; i<count; i++)
+							if ( ids[i] == id )  return &values[i];
+						return nullptr;
+					}
+				};
+
+				/// Looks up registered and unregistered IDs (half each) and returns the average time per lookup.
+				template <typename TRegistry>
+				double measureNanosecondsPerLookup( const TRegistry &registry, const uint32_t *ids, size_t idCount ) {
+					uint32_t pseudoRandom = 0x2545F491, sum = 0;
+					const auto start = std::chrono::steady_clock::now();
+					for (uint32_t i = 0; i<LookupCount; i++) {
+						const uint32_t random = nextPseudoRandom( pseudoRandom );
+						const uint32_t id = (random & 1)  ?  ids[(random >> 1) % idCount]  :  random | 1;  // --> Registered IDs are even
+						const uint32_t *value = registry.find( id );
+						if ( value )  sum += *value;
+					}
+					const std::chrono::duration<double> duration = std::chrono::steady_clock::now() - start;
+					volatile uint32_t sink = sum;
+					(void)sink;
+					return duration.count() / LookupCount * 1e9;
+				}
+			}
+
+
+			template <size_t TElementCount>
+			void HashMapBenchmark::compareLookups() {
+				static LinearRegistry<TElementCount> linearRegistry;
+				static HashMap<uint32_t, uint32_t, TElementCount * 5 / 4> hashMap;  // --> Load factor 80 %
+				static uint32_t ids[TElementCount];
+
+				uint32_t pseudoRandom = 12345;
+				for (size_t i = 0; i<TElementCount; ) {
+					const uint32_t id = nextPseudoRandom( pseudoRandom ) & ~UINT32_C(1);
+					if ( hashMap.insert(id, static_cast<uint32_t>(i)) ) {
+						linearRegistry.insert( id, static_cast<uint32_t>(i) );
+						ids[i++] = id;
+					}
+				}
+
+				printf( "%5u IDs:   linear search %7.2f ns   HashMap %6.2f ns\n", static_cast<unsigned>(TElementCount),
+				        measureNanosecondsPerLookup(linearRegistry, ids, TElementCount), measureNanosecondsPerLookup(hashMap, ids, TElementCount) );
+			}
+
+			void HashMapBenchmark::performAllBenchmarks() {
+				printf( "Lookup of uint32_t IDs (50 %% registered):\n" );
+				compareLookups<8>();
+				compareLookups<32>();
+				compareLookups<128>();
+				compareLookups<1024>();
+			}
+
+		} /* namespace StaticMemory */
+	} /* namespace Lists */
+} /* namespace Util */
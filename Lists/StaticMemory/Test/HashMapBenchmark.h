@@ -0,0 +1,41 @@
+/*
+ * HashMapBenchmark.h
+ *
+ *  Created on: 16.10.2026
+ *      Author: agent
+ *
+ *  Description:
+ *  	Lookup benchmark of the Robin Hood hash map, compared to the linear search over an array of registered
+ *  	IDs it replaces. Intended to be run on the (Linux) host.
+ */
+
+#ifndef UTIL_LISTS_STATICMEMORY_TEST_HASH_MAP_BENCHMARK_H_
+#define UTIL_LISTS_STATICMEMORY_TEST_HASH_MAP_BENCHMARK_H_
+
+#include <stdint-gcc.h>
+#include <stddef.h>
+
+
+namespace Util {
+	namespace Lists {
+		namespace StaticMemory {
+
+			class HashMapBenchmark {
+					HashMapBenchmark() = delete;
+
+				public:
+					/**
+					 * Runs all benchmarks and prints the results to stdout.
+					 */
+					static void performAllBenchmarks();
+
+				private:
+					template <size_t TElementCount>
+					static void compareLookups();
+			};
+
+		} /* namespace StaticMemory */
+	} /* namespace Lists */
+} /* namespace Util */
+
+#endif /* UTIL_LISTS_STATICMEMORY_TEST_HASH_MAP_BENCHMARK_H_ */
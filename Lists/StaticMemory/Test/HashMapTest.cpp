@@ -0,0 +1,133 @@
+/*
+ * HashMapTest.cpp
+ *
+ *  Created on: 16.10.2026
+ *      Author: agent
+ *
+ *  Description:
+ *  	Tests for Robin Hood hash map.
+ */
+
+#include "../HashMap.h"
+#include "HashMapTest.h"
+
+
+namespace Util {
+	namespace Lists {
+		namespace StaticMemory {
+
+			namespace {
+				/// Maps all keys onto four home slots, to provoke long probe sequences.
+				struct CollidingHash {
+					uint32_t operator()( uint32_t key ) const  { return (key % 4) << 30; }
+				};
+
+				/// Value type which keeps track of the number of living instances.
+				class TrackedValue {
+					public:
+						static int32_t LivingInstances;
+
+						explicit TrackedValue( uint32_t value = 0 ) : m_value(value)  { LivingInstances++; }
+						TrackedValue( const TrackedValue &other ) : m_value(other.m_value)  { LivingInstances++; }
+						TrackedValue& operator=( const TrackedValue& ) = default;
+						~TrackedValue()  { LivingInstances--; }
+
+						uint32_t value() const  { return m_value; }
+
+					private:
+						uint32_t m_value;
+				};
+				int32_t TrackedValue::LivingInstances = 0;
+			}
+
+
+			void HashMapTest::assertTrue( bool value ) {
+				if ( !value )  while(1){}
+			}
+
+			void HashMapTest::assertEquals( uint32_t expected, uint32_t value ) {
+				if ( expected != value )  while(1){}
+			}
+
+
+			void HashMapTest::performAllTests() {
+				performTest_InsertFindRemove();
+				performTest_ProbeBound();
+				performTest_NonPodValues();
+			}
+
+			void HashMapTest::performTest_InsertFindRemove() {
+				HashMap<uint32_t, uint32_t, 100> map;
+
+				assertTrue( map.isEmpty() );
+				assertTrue( map.find(7) == nullptr );
+				assertTrue( !map.remove(7) );
+
+				// IDs spread over a large range, at a load factor of 80 %
+				for (uint32_t i = 0; i<80; i++)  assertTrue( map.insert(i * 7919 + 13, i) );
+				assertTrue( !map.insert(13, 0) );  // --> Key present already
+				assertEquals( 80, map.size() );
+				for (uint32_t i = 0; i<80; i++)  assertEquals( i, *map.find(i * 7919 + 13) );
+				assertTrue( !map.contains(14) );
+
+				// Remove every second element; the remaining ones must still be found
+				uint32_t removed;
+				for (uint32_t i = 0; i<80; i += 2) {
+					assertTrue( map.remove(i * 7919 + 13, &removed) );
+					assertEquals( i, removed );
+				}
+				assertEquals( 40, map.size() );
+				for (uint32_t i = 0; i<80; i++)  assertTrue( map.contains(i * 7919 + 13) == (i % 2 == 1) );
+
+				uint32_t sum = 0;
+				map.forEach( [&sum](const uint32_t&, uint32_t &value) { sum += value; } );
+				assertEquals( 40 * 40, sum );
+
+				*map.find( 1 * 7919 + 13 ) = 1000;
+				assertEquals( 1000, *map.find(1 * 7919 + 13) );
+
+				map.clear();
+				assertTrue( map.isEmpty() );
+				assertTrue( !map.contains(1 * 7919 + 13) );
+			}
+
+			void HashMapTest::performTest_ProbeBound() {
+				HashMap<uint32_t, uint32_t, 64, 5, CollidingHash> map;
+				assertEquals( 5, map.maxProbeCount() );
+
+				// All keys share home slot 0. Only five of them fit into the probe bound.
+				for (uint32_t i = 0; i<5; i++)  assertTrue( map.insert(i * 4, i) );
+				assertTrue( !map.insert(20, 5) );
+				assertEquals( 5, map.size() );
+				assertTrue( !map.contains(20) );
+
+				// Keys of home slot 16 don't collide with them
+				for (uint32_t i = 0; i<5; i++)  assertTrue( map.insert(i * 4 + 1, i) );
+				for (uint32_t i = 0; i<5; i++)  assertEquals( i, *map.find(i * 4) );
+
+				// After removing, the slot can be reused
+				assertTrue( map.remove(0) );
+				assertTrue( map.insert(20, 5) );
+				assertEquals( 5, *map.find(20) );
+			}
+
+			void HashMapTest::performTest_NonPodValues() {
+				{
+					HashMap<const void*, TrackedValue, 8> map;
+					uint32_t objects[8];
+					for (uint32_t i = 0; i<8; i++)  assertTrue( map.emplace(&objects[i], i) );
+					assertEquals( 8, TrackedValue::LivingInstances );
+					assertTrue( map.isFull() );
+
+					TrackedValue removed;
+					assertTrue( map.remove(&objects[3], &removed) );
+					assertEquals( 3, removed.value() );
+					assertEquals( 8, TrackedValue::LivingInstances );
+					assertEquals( 7, map.find(&objects[7])->value() );
+				}
+				assertEquals( 0, TrackedValue::LivingInstances );  // --> Remaining values were destroyed along with the map
+			}
+
+		} /* namespace StaticMemory */
+	} /* namespace Lists */
+} /* namespace Util */
@@ -0,0 +1,41 @@
+/*
+ * HashMapTest.h
+ *
+ *  Created on: 16.10.2026
+ *      Author: agent
+ *
+ *  Description:
+ *  	Tests for Robin Hood hash map.
+ */
+
+#ifndef UTIL_LISTS_STATICMEMORY_TEST_HASH_MAP_TEST_H_
+#define UTIL_LISTS_STATICMEMORY_TEST_HASH_MAP_TEST_H_
+
+#include <stdint-gcc.h>
+
+
+namespace Util {
+	namespace Lists {
+		namespace StaticMemory {
+
+			class HashMapTest {
+					HashMapTest() = delete;
+
+				public:
+					static void performAllTests();
+
+				private:
+					static void assertTrue( bool value );
+					static void assertEquals( uint32_t expected, uint32_t value );
+
+					static void performTest_InsertFindRemove();
+					static void performTest_ProbeBound();
+					static void performTest_NonPodValues();
+
+			};
+
+		} /* namespace StaticMemory */
+	} /* namespace Lists */
+} /* namespace Util */
+
+#endif /* UTIL_LISTS_STATICMEMORY_TEST_HASH_MAP_TEST_H_ */
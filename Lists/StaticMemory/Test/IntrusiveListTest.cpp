@@ -0,0 +1,159 @@
+/*
+ * IntrusiveListTest.cpp
+ *
+ *  Created on: 16.10.2026
+ *      Author: agent
+ *
+ *  Description:
+ *  	Tests for intrusive doubly linked list.
+ */
+
+#include "../IntrusiveList.h"
+#include "IntrusiveListTest.h"
+
+#include <algorithm>
+
+
+namespace Util {
+	namespace Lists {
+		namespace StaticMemory {
+
+			namespace {
+				struct ReadyTag;
+				struct TimerTag;
+
+				class Node : public IntrusiveListHook<> {
+					public:
+						explicit Node( uint32_t value = 0 ) : value(value) {}
+						uint32_t value;
+				};
+
+				/// Element which can be part of two lists at the same time.
+				class Task : public IntrusiveListHook<ReadyTag>, public IntrusiveListHook<TimerTag> {
+					public:
+						explicit Task( uint32_t id ) : id(id) {}
+						uint32_t id;
+				};
+			}
+
+
+			void IntrusiveListTest::assertTrue( bool value ) {
+				if ( !value )  while(1){}
+			}
+
+			void IntrusiveListTest::assertEquals( uint32_t expected, uint32_t value ) {
+				if ( expected != value )  while(1){}
+			}
+
+
+			void IntrusiveListTest::performAllTests() {
+				performTest_LinkAndUnlink();
+				performTest_Iteration();
+				performTest_MultipleHooks();
+			}
+
+			void IntrusiveListTest::performTest_LinkAndUnlink() {
+				static_assert( sizeof(IntrusiveListHook<>) == 2*sizeof(void*), "A hook should consist of two pointers only" );
+
+				IntrusiveList<Node> list;
+				Node a(1), b(2), c(3);
+
+				assertTrue( list.isEmpty() );
+				assertTrue( list.getHead() == nullptr );
+				assertTrue( list.removeTail() == nullptr );
+
+				assertTrue( list.addTail(b) );
+				assertTrue( list.addHead(a) );
+				assertTrue( list.add(c) );
+				assertTrue( !list.addHead(b) );  // --> Already linked
+				assertEquals( 3, list.size() );
+				assertTrue( list.getHead() == &a );
+				assertTrue( list.getTail() == &c );
+				assertTrue( list.contains(b) );
+
+				assertTrue( list.remove(b) );
+				assertTrue( !b.isLinked() );
+				assertTrue( !list.remove(b) );
+				assertTrue( !list.contains(b) );
+				assertTrue( list.removeHead() == &a );
+				assertTrue( list.removeHead() == &c );
+				assertTrue( list.isEmpty() );
+
+				// Elements unlink themselves, both directly and upon destruction
+				list.add( a );
+				{
+					Node temporary(4);
+					list.add( temporary );
+					list.add( b );
+					assertEquals( 3, list.size() );
+				}
+				assertEquals( 2, list.size() );
+				a.unlink();
+				assertTrue( list.getHead() == &b );
+
+				// Copies are not linked
+				Node copy( b );
+				assertTrue( b.isLinked()  &&  !copy.isLinked() );
+
+				list.clear();
+				assertTrue( list.isEmpty() );
+				assertTrue( !b.isLinked() );
+			}
+
+			void IntrusiveListTest::performTest_Iteration() {
+				IntrusiveList<Node> list;
+				const IntrusiveList<Node> &constList = list;
+				Node nodes[] = { Node(5), Node(3), Node(8), Node(1) };
+
+				assertTrue( list.begin() == list.end() );
+				for (Node &node : nodes)  list.add( node );
+
+				uint32_t sum = 0;
+				for (const Node &node : constList)  sum += node.value;
+				assertEquals( 17, sum );
+
+				Node seven(7);
+				auto position = std::find_if( list.begin(), list.end(), [](const Node &node) { return node.value == 8; } );
+				assertTrue( list.add(position, seven) );  // --> 5 3 7 8 1
+				assertEquals( 5, static_cast<uint32_t>(std::distance(list.cbegin(), list.cend())) );
+
+				// Reverse iteration
+				uint32_t expected[] = { 1, 8, 7, 3, 5 };
+				uint32_t i = 0;
+				for (auto it = list.end(); it != list.begin(); )  assertEquals( expected[i++], (--it)->value );
+
+				// Removal while iterating
+				for (auto it = list.begin(); it != list.end(); ) {
+					if ( it->value > 4 )  it = list.remove( it );
+					else  ++it;
+				}
+				assertEquals( 2, list.size() );
+				assertTrue( !seven.isLinked() );
+
+				list.forEach( [&list](Node &node) { if ( node.value == 3 )  list.remove( node ); } );
+				assertEquals( 1, list.size() );
+				assertEquals( 1, list.getHead()->value );
+			}
+
+			void IntrusiveListTest::performTest_MultipleHooks() {
+				IntrusiveList<Task, ReadyTag> readyTasks;
+				IntrusiveList<Task, TimerTag> timerTasks;
+				Task a(1), b(2);
+
+				assertTrue( readyTasks.add(a) );
+				assertTrue( readyTasks.add(b) );
+				assertTrue( timerTasks.add(b) );
+				assertTrue( timerTasks.add(a) );
+
+				assertEquals( 1, readyTasks.getHead()->id );
+				assertEquals( 2, timerTasks.getHead()->id );
+
+				readyTasks.remove( a );
+				assertTrue( !static_cast<IntrusiveListHook<ReadyTag>&>(a).isLinked() );
+				assertTrue( static_cast<IntrusiveListHook<TimerTag>&>(a).isLinked() );
+				assertEquals( 2, timerTasks.size() );
+			}
+
+		} /* namespace StaticMemory */
+	} /* namespace Lists */
+} /* namespace Util */
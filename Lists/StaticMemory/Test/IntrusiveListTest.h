@@ -0,0 +1,41 @@
+/*
+ * IntrusiveListTest.h
+ *
+ *  Created on: 16.10.2026
+ *      Author: agent
+ *
+ *  Description:
+ *  	Tests for intrusive doubly linked list.
+ */
+
+#ifndef UTIL_LISTS_STATICMEMORY_TEST_INTRUSIVE_LIST_TEST_H_
+#define UTIL_LISTS_STATICMEMORY_TEST_INTRUSIVE_LIST_TEST_H_
+
+#include <stdint-gcc.h>
+
+
+namespace Util {
+	namespace Lists {
+		namespace StaticMemory {
+
+			class IntrusiveListTest {
+					IntrusiveListTest() = delete;
+
+				public:
+					static void performAllTests();
+
+				private:
+					static void assertTrue( bool value );
+					static void assertEquals( uint32_t expected, uint32_t value );
+
+					static void performTest_LinkAndUnlink();
+					static void performTest_Iteration();
+					static void performTest_MultipleHooks();
+
+			};
+
+		} /* namespace StaticMemory */
+	} /* namespace Lists */
+} /* namespace Util */
+
+#endif /* UTIL_LISTS_STATICMEMORY_TEST_INTRUSIVE_LIST_TEST_H_ */
@@ -0,0 +1,162 @@
+/*
+ * LinkedListTest.cpp
+ *
+ *  Created on: 16.10.2026
+ *      Author: agent
+ *
+ *  Description:
+ *  	Tests for doubly linked list.
+ */
+
+#include "../LinkedList.h"
+#include "LinkedListTest.h"
+
+#include <algorithm>
+
+
+namespace Util {
+	namespace Lists {
+		namespace StaticMemory {
+
+			namespace {
+				/// Element type which keeps track of the number of living instances.
+				class TrackedElement {
+					public:
+						static int32_t LivingInstances;
+
+						explicit TrackedElement( uint32_t value = 0 ) : m_value(value)  { LivingInstances++; }
+						TrackedElement( const TrackedElement &other ) : m_value(other.m_value)  { LivingInstances++; }
+						TrackedElement& operator=( const TrackedElement& ) = default;
+						~TrackedElement()  { LivingInstances--; }
+
+						uint32_t value() const  { return m_value; }
+
+					private:
+						uint32_t m_value;
+				};
+				int32_t TrackedElement::LivingInstances = 0;
+			}
+
+
+			void LinkedListTest::assertTrue( bool value ) {
+				if ( !value )  while(1){}
+			}
+
+			void LinkedListTest::assertEquals( uint32_t expected, uint32_t value ) {
+				if ( expected != value )  while(1){}
+			}
+
+
+			void LinkedListTest::performAllTests() {
+				performTest_AddAndRemove();
+				performTest_FreeListReuse();
+				performTest_Iteration();
+				performTest_NonPodElements();
+			}
+
+			void LinkedListTest::performTest_AddAndRemove() {
+				LinkedList<uint32_t, 4> list;
+				uint32_t value = 0;
+
+				assertTrue( list.isEmpty() );
+				assertTrue( list.getHead() == nullptr );
+				assertTrue( !list.removeHead() );
+
+				assertTrue( list.addTail(2) );
+				assertTrue( list.addHead(1) );
+				assertTrue( list.add(3) );
+				assertTrue( list.emplaceTail(4) );
+				assertTrue( list.isFull() );
+				assertTrue( !list.addHead(0) );
+				assertEquals( 4, list.size() );
+
+				assertEquals( 1, *list.getHead() );
+				assertEquals( 4, *list.getTail() );
+				for (uint32_t i = 0; i<4; i++)  assertEquals( i + 1, *list[i] );
+				assertTrue( list[4] == nullptr );
+
+				assertTrue( list.remove(1) );          // --> 1 3 4
+				assertTrue( list.removeTail(&value) ); // --> 1 3
+				assertEquals( 4, value );
+				assertTrue( list.removeHead(&value) ); // --> 3
+				assertEquals( 1, value );
+				assertEquals( 1, list.size() );
+				assertTrue( list.getHead() == list.getTail() );
+				assertEquals( 3, *list.getHead() );
+
+				list.clear();
+				assertTrue( list.isEmpty() );
+				assertTrue( list.getTail() == nullptr );
+			}
+
+			void LinkedListTest::performTest_FreeListReuse() {
+				static_assert( sizeof(LinkedList<uint32_t, 200>) <= 200*8 + 8, "Links should take 8 bits each for up to 254 elements" );
+
+				LinkedList<uint32_t, 200> list;
+				for (uint32_t round = 0; round<3; round++) {
+					for (uint32_t i = 0; i<200; i++)  assertTrue( list.addTail(i) );
+					assertTrue( !list.addTail(0) );
+
+					// Remove every second element, then refill the gaps at the head
+					for (auto it = list.begin(); it != list.end(); ) {
+						it = list.remove( it );
+						if ( it != list.end() )  ++it;
+					}
+					assertEquals( 100, list.size() );
+					for (uint32_t i = 0; i<100; i++)  assertTrue( list.addHead(1000 + i) );
+					assertTrue( list.isFull() );
+
+					assertEquals( 1099, *list[0] );
+					assertEquals( 1, *list[100] );
+					assertEquals( 199, *list.getTail() );
+					list.clear();
+				}
+			}
+
+			void LinkedListTest::performTest_Iteration() {
+				LinkedList<uint32_t, 8> list;
+				const LinkedList<uint32_t, 8> &constList = list;
+
+				assertTrue( list.begin() == list.end() );
+				for (uint32_t i : { 5, 3, 8, 1 })  list.add( i );
+
+				uint32_t sum = 0;
+				for (uint32_t value : constList)  sum += value;
+				assertEquals( 17, sum );
+
+				auto position = std::find( list.begin(), list.end(), 8 );
+				assertTrue( list.emplace(position, 7) );  // --> 5 3 7 8 1
+				assertEquals( 7, *list[2] );
+				assertEquals( 5, static_cast<uint32_t>(std::distance(list.cbegin(), list.cend())) );
+
+				// Reverse iteration
+				uint32_t expected[] = { 1, 8, 7, 3, 5 };
+				uint32_t i = 0;
+				for (auto it = list.end(); it != list.begin(); )  assertEquals( expected[i++], *--it );
+
+				list.forEach( [](uint32_t &value) { value *= 2; } );
+				assertEquals( 16, *std::max_element(constList.begin(), constList.end()) );
+			}
+
+			void LinkedListTest::performTest_NonPodElements() {
+				{
+					LinkedList<TrackedElement, 3> list;
+					TrackedElement removed;
+					list.addTail( TrackedElement(1) );
+					list.emplaceHead( 2 );
+					list.emplaceTail( 3 );
+					assertEquals( 4, TrackedElement::LivingInstances );
+
+					list.removeHead( &removed );
+					assertEquals( 2, removed.value() );
+					assertEquals( 3, TrackedElement::LivingInstances );
+					list.remove( 0 );
+					assertEquals( 2, TrackedElement::LivingInstances );
+					assertEquals( 3, list.getHead()->value() );
+				}
+				assertEquals( 0, TrackedElement::LivingInstances );  // --> Remaining elements were destroyed along with the list
+			}
+
+		} /* namespace StaticMemory */
+	} /* namespace Lists */
+} /* namespace Util */
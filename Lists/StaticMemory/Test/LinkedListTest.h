@@ -0,0 +1,42 @@
+/*
+ * LinkedListTest.h
+ *
+ *  Created on: 16.10.2026
+ *      Author: agent
+ *
+ *  Description:
+ *  	Tests for doubly linked list.
+ */
+
+#ifndef UTIL_LISTS_STATICMEMORY_TEST_LINKED_LIST_TEST_H_
+#define UTIL_LISTS_STATICMEMORY_TEST_LINKED_LIST_TEST_H_
+
+#include <stdint-gcc.h>
+
+
+namespace Util {
+	namespace Lists {
+		namespace StaticMemory {
+
+			class LinkedListTest {
+					LinkedListTest() = delete;
+
+				public:
+					static void performAllTests();
+
+				private:
+					static void assertTrue( bool value );
+					static void assertEquals( uint32_t expected, uint32_t value );
+
+					static void performTest_AddAndRemove();
+					static void performTest_FreeListReuse();
+					static void performTest_Iteration();
+					static void performTest_NonPodElements();
+
+			};
+
+		} /* namespace StaticMemory */
+	} /* namespace Lists */
+} /* namespace Util */
+
+#endif /* UTIL_LISTS_STATICMEMORY_TEST_LINKED_LIST_TEST_H_ */
@@ -0,0 +1,88 @@
+/*
+ * MpmcFifoBenchmark.cpp
+ *
+ *  Created on: 16.10.2026
+ *      Author: agent
+ *
+ *  Description:
+ *  	Throughput benchmark of the lock-free MPMC circular buffer, compared to a Mutex protected Fifo.
+ *  	Uses threads and thus needs to be run on the (Linux) host.
+ */
+
+#include "../MpmcFifo.h"
+#include "../Fifo.h"
+#include "MpmcFifoBenchmark.h"
+
+#include <Mutex/StdMutex.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+#include <stdio.h>
+
+
+namespace Util {
+	namespace Lists {
+		namespace StaticMemory {
+
+			namespace {
+				constexpr uint32_t ElementCount = 1000000;
+
+				MpmcFifo<uint32_t, 256>                                 LockFreeFifo;
+				Fifo<uint32_t, false, 255, Util::Mutex::StdMutex<>>     MutexFifo;
+			}
+
+
+			template <typename TFifo>
+			double MpmcFifoBenchmark::measureMegaElementsPerSecond( TFifo &fifo, unsigned threadCount ) {
+				std::atomic<uint32_t> consumedCount(0);
+				std::atomic<uint64_t> consumedSum(0);
+				std::vector<std::thread> threads;
+
+				const auto start = std::chrono::steady_clock::now();
+				for (unsigned t = 0; t<threadCount; t++) {
+					threads.emplace_back( [&fifo, t, threadCount](){
+						for (uint32_t value = t; value < ElementCount; ) {
+							if ( fifo.enqueue(value) )  value += threadCount;
+							else                        std::this_thread::yield();
+						}
+					} );
+					threads.emplace_back( [&fifo, &consumedCount, &consumedSum](){
+						uint64_t sum = 0;
+						while ( consumedCount.load(std::memory_order_relaxed) < ElementCount ) {
+							uint32_t value;
+							if ( fifo.dequeue(&value) ) {
+								sum += value;
+								consumedCount.fetch_add( 1, std::memory_order_relaxed );
+							} else {
+								std::this_thread::yield();
+							}
+						}
+						consumedSum.fetch_add( sum );
+					} );
+				}
+				for (auto &thread : threads)  thread.join();
+				const std::chrono::duration<double> duration = std::chrono::steady_clock::now() - start;
+
+				const uint64_t expectedSum = static_cast<uint64_t>(ElementCount) * (ElementCount - 1) / 2;
+				if ( consumedSum.load() != expectedSum )  printf( "  (ELEMENTS LOST OR DUPLICATED!)\n" );
+				return ElementCount / duration.count() / 1e6;
+			}
+
+			void MpmcFifoBenchmark::performAllBenchmarks( unsigned maxThreadCount ) {
+				if ( maxThreadCount == 0 )  maxThreadCount = std::thread::hardware_concurrency() / 2;
+				if ( maxThreadCount == 0 )  maxThreadCount = 1;
+
+				printf( "MPMC throughput (%u elements, %u hardware threads):\n", static_cast<unsigned>(ElementCount), std::thread::hardware_concurrency() );
+				printf( "  producers+consumers   MpmcFifo [M/s]   Fifo+std::mutex [M/s]\n" );
+				for (unsigned threadCount = 1; threadCount <= maxThreadCount; threadCount *= 2) {
+					const double lockFree = measureMegaElementsPerSecond( LockFreeFifo, threadCount );
+					const double locked   = measureMegaElementsPerSecond( MutexFifo, threadCount );
+					printf( "  %6u + %-6u        %10.2f       %10.2f\n", threadCount, threadCount, lockFree, locked );
+				}
+			}
+
+		} /* namespace StaticMemory */
+	} /* namespace Lists */
+} /* namespace Util */
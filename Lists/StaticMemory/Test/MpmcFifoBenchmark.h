@@ -0,0 +1,43 @@
+/*
+ * MpmcFifoBenchmark.h
+ *
+ *  Created on: 16.10.2026
+ *      Author: agent
+ *
+ *  Description:
+ *  	Throughput benchmark of the lock-free MPMC circular buffer, compared to a Mutex protected Fifo.
+ *  	Uses threads and thus needs to be run on the (Linux) host.
+ */
+
+#ifndef UTIL_LISTS_STATICMEMORY_TEST_MPMC_FIFO_BENCHMARK_H_
+#define UTIL_LISTS_STATICMEMORY_TEST_MPMC_FIFO_BENCHMARK_H_
+
+#include <stdint-gcc.h>
+#include <stddef.h>
+
+
+namespace Util {
+	namespace Lists {
+		namespace StaticMemory {
+
+			class MpmcFifoBenchmark {
+					MpmcFifoBenchmark() = delete;
+
+				public:
+					/**
+					 * Runs the benchmark with 1..maxThreadCount producers and as many consumers, and prints the results to stdout.
+					 *
+					 * @param maxThreadCount 	..	Maximum number of producers (and consumers). If 0, half the number of hardware threads is used.
+					 */
+					static void performAllBenchmarks( unsigned maxThreadCount = 0 );
+
+				private:
+					template <typename TFifo>
+					static double measureMegaElementsPerSecond( TFifo &fifo, unsigned threadCount );
+			};
+
+		} /* namespace StaticMemory */
+	} /* namespace Lists */
+} /* namespace Util */
+
+#endif /* UTIL_LISTS_STATICMEMORY_TEST_MPMC_FIFO_BENCHMARK_H_ */
@@ -0,0 +1,92 @@
+/*
+ * PoolBenchmark.cpp
+ *
+ *  Created on: 16.10.2026
+ *      Author: agent
+ *
+ *  Description:
+ *  	Allocation benchmark of the fixed-block memory pool, compared to malloc/free and new/delete.
+ *  	Intended to be run on the (Linux) host.
+ */
+
+#include "../Pool.h"
+#include "PoolBenchmark.h"
+
+#include <chrono>
+#include <new>
+#include <stdio.h>
+#include <stdlib.h>
+
+
+namespace Util {
+	namespace Lists {
+		namespace StaticMemory {
+
+			namespace {
+				constexpr uint32_t AllocationCount = 10000000;
+				constexpr uint32_t LiveObjectCount = 64;  ///< Number of objects kept allocated at any time
+
+				struct Message {
+					Message( uint32_t id ) : id(id) {}
+					uint32_t id;
+					uint8_t  payload[28];
+				};
+
+				template <bool LockFree>
+				struct PoolAllocator {
+					Pool<Message, LiveObjectCount, Util::Mutex::NoMutex, LockFree> pool;
+					Message* allocate( uint32_t id )  { return pool.allocate( id ); }
+					void release( Message *message )  { pool.release( message ); }
+				};
+
+				struct MallocAllocator {
+					Message* allocate( uint32_t id )  { return new (malloc(sizeof(Message))) Message( id ); }
+					void release( Message *message )  { message->~Message();  free( message ); }
+				};
+
+				struct NewAllocator {
+					Message* allocate( uint32_t id )  { return new Message( id ); }
+					void release( Message *message )  { delete message; }
+				};
+
+				PoolAllocator<false> LockingPool;
+				PoolAllocator<true>  LockFreePool;
+				MallocAllocator      Malloc;
+				NewAllocator         New;
+			}
+
+
+			template <typename TAllocator>
+			double PoolBenchmark::measureNanosecondsPerAllocation( TAllocator &allocator ) {
+				Message *messages[LiveObjectCount];
+				for (uint32_t i = 0; i<LiveObjectCount; i++)  messages[i] = allocator.allocate( i );
+
+				// Releases objects in pseudo-random order, each one being replaced by a new object right away
+				uint32_t pseudoRandom = 0x2545F491, sum = 0;
+				const auto start = std::chrono::steady_clock::now();
+				for (uint32_t i = 0; i<AllocationCount; i++) {
+					pseudoRandom ^= pseudoRandom << 13;  pseudoRandom ^= pseudoRandom >> 17;  pseudoRandom ^= pseudoRandom << 5;
+					Message *&message = messages[pseudoRandom % LiveObjectCount];
+					sum += message->id;
+					allocator.release( message );
+					message = allocator.allocate( i );
+				}
+				const std::chrono::duration<double> duration = std::chrono::steady_clock::now() - start;
+
+				for (Message *message : messages)  allocator.release( message );
+				volatile uint32_t sink = sum;
+				(void)sink;
+				return duration.count() / AllocationCount * 1e9;
+			}
+
+			void PoolBenchmark::performAllBenchmarks() {
+				printf( "Allocation+release of %u byte objects (%u objects alive):\n", static_cast<unsigned>(sizeof(Message)), static_cast<unsigned>(LiveObjectCount) );
+				printf( "  Pool           %6.2f ns\n", measureNanosecondsPerAllocation(LockingPool) );
+				printf( "  Pool lock-free %6.2f ns\n", measureNanosecondsPerAllocation(LockFreePool) );
+				printf( "  malloc/free    %6.2f ns\n", measureNanosecondsPerAllocation(Malloc) );
+				printf( "  new/delete     %6.2f ns\n", measureNanosecondsPerAllocation(New) );
+			}
+
+		} /* namespace StaticMemory */
+	} /* namespace Lists */
+} /* namespace Util */
@@ -0,0 +1,41 @@
+/*
+ * PoolBenchmark.h
+ *
+ *  Created on: 16.10.2026
+ *      Author: agent
+ *
+ *  Description:
+ *  	Allocation benchmark of the fixed-block memory pool, compared to malloc/free and new/delete.
+ *  	Intended to be run on the (Linux) host.
+ */
+
+#ifndef UTIL_LISTS_STATICMEMORY_TEST_POOL_BENCHMARK_H_
+#define UTIL_LISTS_STATICMEMORY_TEST_POOL_BENCHMARK_H_
+
+#include <stdint-gcc.h>
+#include <stddef.h>
+
+
+namespace Util {
+	namespace Lists {
+		namespace StaticMemory {
+
+			class PoolBenchmark {
+					PoolBenchmark() = delete;
+
+				public:
+					/**
+					 * Runs all benchmarks and prints the results to stdout.
+					 */
+					static void performAllBenchmarks();
+
+				private:
+					template <typename TAllocator>
+					static double measureNanosecondsPerAllocation( TAllocator &allocator );
+			};
+
+		} /* namespace StaticMemory */
+	} /* namespace Lists */
+} /* namespace Util */
+
+#endif /* UTIL_LISTS_STATICMEMORY_TEST_POOL_BENCHMARK_H_ */
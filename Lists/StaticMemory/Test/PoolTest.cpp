@@ -0,0 +1,155 @@
+/*
+ * PoolTest.cpp
+ *
+ *  Created on: 16.10.2026
+ *      Author: agent
+ *
+ *  Description:
+ *  	Tests for fixed-block memory pool. The stress test of the lock-free mode uses several threads and
+ *  	thus needs to be run on the (Linux) host.
+ */
+
+#include "../Pool.h"
+#include "PoolTest.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+
+namespace Util {
+	namespace Lists {
+		namespace StaticMemory {
+
+			namespace {
+				struct Message {
+					static int32_t LivingInstances;
+
+					Message( uint32_t id, uint16_t length ) : id(id), length(length)  { LivingInstances++; }
+					~Message()  { LivingInstances--; }
+
+					uint32_t id;
+					uint16_t length;
+					uint8_t  payload[26];
+				};
+				int32_t Message::LivingInstances = 0;
+			}
+
+
+			void PoolTest::assertTrue( bool value ) {
+				if ( !value )  while(1){}
+			}
+
+			void PoolTest::assertEquals( uint32_t expected, uint32_t value ) {
+				if ( expected != value )  while(1){}
+			}
+
+
+			void PoolTest::performAllTests() {
+				performTest_AllocateAndRelease();
+				performTest_Handles();
+				performTest_LockFreeStress();
+			}
+
+			void PoolTest::performTest_AllocateAndRelease() {
+				static_assert( sizeof(Pool<uint8_t, 100>) < 2*100, "Free list links must be stored within the blocks" );
+
+				Pool<Message, 4> pool;
+				Message *messages[4];
+
+				assertEquals( 4, pool.capacity() );
+				for (uint32_t i = 0; i<4; i++) {
+					messages[i] = pool.allocate( i, static_cast<uint16_t>(10 * i) );
+					assertTrue( messages[i] != nullptr );
+					assertTrue( pool.contains(messages[i]) );
+				}
+				assertEquals( 4, Message::LivingInstances );
+				assertEquals( 4, pool.usedCount() );
+				assertEquals( 0, pool.freeCount() );
+				assertTrue( pool.allocate(9, 0) == nullptr );
+				assertEquals( 1, pool.failedAllocationCount() );
+
+				for (uint32_t i = 0; i<4; i++) {
+					assertEquals( i, messages[i]->id );
+					assertEquals( 10 * i, messages[i]->length );
+				}
+
+				pool.release( messages[1] );
+				pool.release( messages[3] );
+				pool.release( nullptr );
+				assertEquals( 2, Message::LivingInstances );
+				assertEquals( 2, pool.usedCount() );
+				assertEquals( 4, pool.peakUsedCount() );
+
+				// Freed blocks are reused, most recently released first
+				assertTrue( pool.allocate(5, 0) == messages[3] );
+				assertTrue( pool.allocate(6, 0) == messages[1] );
+				for (Message *message : messages)  pool.release( message );
+				assertEquals( 0, pool.usedCount() );
+				assertEquals( 0, Message::LivingInstances );
+
+				const Message outside( 0, 0 );
+				assertTrue( !pool.contains(&outside) );
+			}
+
+			void PoolTest::performTest_Handles() {
+				Pool<Message, 2> pool;
+				{
+					auto first = pool.make( 1, 0 );
+					auto second = pool.make( 2, 0 );
+					auto third = pool.make( 3, 0 );
+					assertTrue( first  &&  second );
+					assertTrue( !third );
+					assertEquals( 2, first->id + (*first).length + 1 );
+
+					third = std::move( second );  // --> Ownership moves
+					assertTrue( !second );
+					assertEquals( 2, third->id );
+					assertEquals( 2, pool.usedCount() );
+
+					first.reset();
+					assertEquals( 1, pool.usedCount() );
+					Message *detached = third.detach();
+					pool.release( detached );
+					assertEquals( 0, pool.usedCount() );
+
+					first = pool.make( 4, 0 );
+				}
+				assertEquals( 0, pool.usedCount() );  // --> Released upon destruction of the handles
+				assertEquals( 0, Message::LivingInstances );
+			}
+
+			void PoolTest::performTest_LockFreeStress() {
+				constexpr unsigned ThreadCount = 4;
+				constexpr uint32_t IterationsPerThread = 200000;
+				static Pool<uint32_t, 16, Util::Mutex::NoMutex, true> pool;
+				std::atomic<uint32_t> errorCount(0);
+				std::vector<std::thread> threads;
+
+				for (unsigned t = 0; t<ThreadCount; t++) {
+					threads.emplace_back( [&errorCount, t]() {
+						uint32_t *objects[3] = {};
+						for (uint32_t i = 0; i<IterationsPerThread; i++) {
+							uint32_t *&object = objects[i % 3];
+							if ( object ) {
+								if ( *object != t * IterationsPerThread + i - 3 )  errorCount++;  // --> Block was handed out twice
+								pool.release( object );
+							}
+							object = pool.allocate( t * IterationsPerThread + i );
+							if ( object == nullptr )  errorCount++;  // --> At most 12 of 16 blocks are in use
+						}
+						for (uint32_t *object : objects)  pool.release( object );
+					} );
+				}
+				for (auto &thread : threads)  thread.join();
+
+				assertEquals( 0, errorCount.load() );
+				assertEquals( 0, pool.usedCount() );
+				assertTrue( pool.peakUsedCount() <= 3 * ThreadCount );
+				for (uint32_t i = 0; i<16; i++)  assertTrue( pool.allocate(i) != nullptr );  // --> No block got lost
+				assertTrue( pool.allocate(0) == nullptr );
+			}
+
+		} /* namespace StaticMemory */
+	} /* namespace Lists */
+} /* namespace Util */
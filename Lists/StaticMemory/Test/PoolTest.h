@@ -0,0 +1,42 @@
+/*
+ * PoolTest.h
+ *
+ *  Created on: 16.10.2026
+ *      Author: agent
+ *
+ *  Description:
+ *  	Tests for fixed-block memory pool. The stress test of the lock-free mode uses several threads and
+ *  	thus needs to be run on the (Linux) host.
+ */
+
+#ifndef UTIL_LISTS_STATICMEMORY_TEST_POOL_TEST_H_
+#define UTIL_LISTS_STATICMEMORY_TEST_POOL_TEST_H_
+
+#include <stdint-gcc.h>
+
+
+namespace Util {
+	namespace Lists {
+		namespace StaticMemory {
+
+			class PoolTest {
+					PoolTest() = delete;
+
+				public:
+					static void performAllTests();
+
+				private:
+					static void assertTrue( bool value );
+					static void assertEquals( uint32_t expected, uint32_t value );
+
+					static void performTest_AllocateAndRelease();
+					static void performTest_Handles();
+					static void performTest_LockFreeStress();
+
+			};
+
+		} /* namespace StaticMemory */
+	} /* namespace Lists */
+} /* namespace Util */
+
+#endif /* UTIL_LISTS_STATICMEMORY_TEST_POOL_TEST_H_ */
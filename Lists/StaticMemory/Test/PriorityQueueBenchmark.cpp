@@ -0,0 +1,81 @@
+/*
+ * PriorityQueueBenchmark.cpp
+ *
+ *  Created on: 16.10.2026
+ *      Author: agent
+ *
+ *  Description:
+ *  	Benchmark of the priority queue (binary vs. 4-ary layout), compared to std::priority_queue.
+ *  	Intended to be run on the (Linux) host.
+ */
+
+#include "../PriorityQueue.h"
+#include "PriorityQueueBenchmark.h"
+
+#include <chrono>
+#include <functional>
+#include <queue>
+#include <stdio.h>
+#include <vector>
+
+
+namespace Util {
+	namespace Lists {
+		namespace StaticMemory {
+
+			namespace {
+				constexpr uint32_t OperationCount = 5000000;
+
+				/// Adapts std::priority_queue (largest first) to the interface of PriorityQueue (smallest first).
+				struct StdPriorityQueue {
+					std::priority_queue<uint32_t, std::vector<uint32_t>, std::greater<uint32_t>> queue;
+					void push( uint32_t value )       { queue.push( value ); }
+					const uint32_t* peek() const      { return &queue.top(); }
+					bool pop( uint32_t *destination ) { *destination = queue.top();  queue.pop();  return true; }
+				};
+
+				PriorityQueue<uint32_t, 64, std::less<uint32_t>, 2>    SmallBinaryQueue;
+				PriorityQueue<uint32_t, 64, std::less<uint32_t>, 4>    SmallQuaternaryQueue;
+				StdPriorityQueue                                       SmallStdQueue;
+				PriorityQueue<uint32_t, 16000, std::less<uint32_t>, 2> LargeBinaryQueue;
+				PriorityQueue<uint32_t, 16000, std::less<uint32_t>, 4> LargeQuaternaryQueue;
+				StdPriorityQueue                                       LargeStdQueue;
+			}
+
+
+			/// "Hold" model of a deadline scheduler: The earliest deadline gets popped and rescheduled at a later time.
+			template <typename TQueue>
+			double PriorityQueueBenchmark::measureNanosecondsPerOperation( TQueue &queue, size_t elementCount ) {
+				uint32_t pseudoRandom = 0x2545F491;
+				for (size_t i = 0; i<elementCount; i++) {
+					pseudoRandom ^= pseudoRandom << 13;  pseudoRandom ^= pseudoRandom >> 17;  pseudoRandom ^= pseudoRandom << 5;
+					queue.push( pseudoRandom % 1000 );
+				}
+
+				uint32_t deadline = 0;
+				const auto start = std::chrono::steady_clock::now();
+				for (uint32_t i = 0; i<OperationCount; i++) {
+					pseudoRandom ^= pseudoRandom << 13;  pseudoRandom ^= pseudoRandom >> 17;  pseudoRandom ^= pseudoRandom << 5;
+					queue.pop( &deadline );
+					queue.push( deadline + pseudoRandom % 1000 );
+				}
+				const std::chrono::duration<double> duration = std::chrono::steady_clock::now() - start;
+
+				while ( elementCount-- )  queue.pop( &deadline );
+				return duration.count() / OperationCount * 1e9;
+			}
+
+			void PriorityQueueBenchmark::performAllBenchmarks() {
+				printf( "Pop+push of uint32_t deadlines, 64 elements:\n" );
+				printf( "  PriorityQueue binary     %6.2f ns\n", measureNanosecondsPerOperation(SmallBinaryQueue, 64) );
+				printf( "  PriorityQueue 4-ary      %6.2f ns\n", measureNanosecondsPerOperation(SmallQuaternaryQueue, 64) );
+				printf( "  std::priority_queue      %6.2f ns\n", measureNanosecondsPerOperation(SmallStdQueue, 64) );
+				printf( "Pop+push of uint32_t deadlines, 16000 elements:\n" );
+				printf( "  PriorityQueue binary     %6.2f ns\n", measureNanosecondsPerOperation(LargeBinaryQueue, 16000) );
+				printf( "  PriorityQueue 4-ary      %6.2f ns\n", measureNanosecondsPerOperation(LargeQuaternaryQueue, 16000) );
+				printf( "  std::priority_queue      %6.2f ns\n", measureNanosecondsPerOperation(LargeStdQueue, 16000) );
+			}
+
+		} /* namespace StaticMemory */
+	} /* namespace Lists */
+} /* namespace Util */
@@ -0,0 +1,41 @@
+/*
+ * PriorityQueueBenchmark.h
+ *
+ *  Created on: 16.10.2026
+ *      Author: agent
+ *
+ *  Description:
+ *  	Benchmark of the priority queue (binary vs. 4-ary layout), compared to std::priority_queue.
+ *  	Intended to be run on the (Linux) host.
+ */
+
+#ifndef UTIL_LISTS_STATICMEMORY_TEST_PRIORITY_QUEUE_BENCHMARK_H_
+#define UTIL_LISTS_STATICMEMORY_TEST_PRIORITY_QUEUE_BENCHMARK_H_
+
+#include <stdint-gcc.h>
+#include <stddef.h>
+
+
+namespace Util {
+	namespace Lists {
+		namespace StaticMemory {
+
+			class PriorityQueueBenchmark {
+					PriorityQueueBenchmark() = delete;
+
+				public:
+					/**
+					 * Runs all benchmarks and prints the results to stdout.
+					 */
+					static void performAllBenchmarks();
+
+				private:
+					template <typename TQueue>
+					static double measureNanosecondsPerOperation( TQueue &queue, size_t elementCount );
+			};
+
+		} /* namespace StaticMemory */
+	} /* namespace Lists */
+} /* namespace Util */
+
+#endif /* UTIL_LISTS_STATICMEMORY_TEST_PRIORITY_QUEUE_BENCHMARK_H_ */
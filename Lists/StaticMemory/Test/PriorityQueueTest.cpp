@@ -0,0 +1,131 @@
+/*
+ * PriorityQueueTest.cpp
+ *
+ *  Created on: 16.10.2026
+ *      Author: agent
+ *
+ *  Description:
+ *  	Tests for priority queue.
+ */
+
+#include "../PriorityQueue.h"
+#include "PriorityQueueTest.h"
+
+#include <algorithm>
+#include <functional>
+
+
+namespace Util {
+	namespace Lists {
+		namespace StaticMemory {
+
+			void PriorityQueueTest::assertTrue( bool value ) {
+				if ( !value )  while(1){}
+			}
+
+			void PriorityQueueTest::assertEquals( uint32_t expected, uint32_t value ) {
+				if ( expected != value )  while(1){}
+			}
+
+
+			void PriorityQueueTest::performAllTests() {
+				performTest_Ordering<2>();
+				performTest_Ordering<4>();
+				performTest_Handles();
+				performTest_TopK();
+			}
+
+			template <uint_fast8_t Arity>
+			void PriorityQueueTest::performTest_Ordering() {
+				PriorityQueue<uint32_t, 300, std::less<uint32_t>, Arity> queue;
+				uint32_t values[300];
+				uint32_t pseudoRandom = 12345;
+				for (uint32_t &value : values) {
+					pseudoRandom = pseudoRandom * 1103515245 + 12345;
+					value = (pseudoRandom >> 16) % 1000;
+				}
+
+				assertTrue( queue.isEmpty() );
+				assertTrue( queue.peek() == nullptr );
+				assertTrue( !queue.pop() );
+
+				for (uint32_t value : values)  assertTrue( queue.push(value) != queue.InvalidHandle );
+				assertTrue( queue.isFull() );
+				assertTrue( queue.push(0) == queue.InvalidHandle );
+
+				std::sort( std::begin(values), std::end(values) );
+				uint32_t value;
+				for (uint32_t expected : values) {
+					assertEquals( expected, *queue.peek() );
+					assertTrue( queue.pop(&value) );
+					assertEquals( expected, value );
+				}
+				assertTrue( queue.isEmpty() );
+			}
+
+			void PriorityQueueTest::performTest_Handles() {
+				PriorityQueue<uint32_t, 8> deadlines;
+				const auto a = deadlines.push( 50 );
+				const auto b = deadlines.push( 20 );
+				const auto c = deadlines.push( 70 );
+				const auto d = deadlines.push( 40 );
+				assertEquals( 4, deadlines.size() );
+
+				// Decrease-key: d becomes due first
+				assertTrue( deadlines.decreaseKey(d, 10) );
+				assertTrue( !deadlines.decreaseKey(d, 30) );  // --> Would lower its priority
+				typename decltype(deadlines)::handle_type top;
+				assertEquals( 10, *deadlines.peek(&top) );
+				assertTrue( top == d );
+
+				// Update in both directions
+				assertTrue( deadlines.update(d, 60) );       // --> 20 50 60 70
+				assertTrue( deadlines.update(c, 5) );        // --> 5 20 50 60
+				assertEquals( 5, *deadlines.peek() );
+				assertEquals( 60, *deadlines.get(d) );
+
+				// Handle-based removal
+				uint32_t removed;
+				assertTrue( deadlines.remove(b, &removed) );
+				assertEquals( 20, removed );
+				assertTrue( !deadlines.contains(b) );
+				assertTrue( !deadlines.remove(b) );
+				assertTrue( deadlines.get(b) == nullptr );
+				assertTrue( !deadlines.update(deadlines.InvalidHandle, 0) );
+
+				uint32_t expected[] = { 5, 50, 60 };
+				for (uint32_t value : expected) {
+					deadlines.pop( &removed );
+					assertEquals( value, removed );
+				}
+				assertTrue( !deadlines.contains(a)  &&  !deadlines.contains(c)  &&  !deadlines.contains(d) );
+			}
+
+			void PriorityQueueTest::performTest_TopK() {
+				// Keeps the 5 largest values; the smallest of them is on top
+				PriorityQueue<uint32_t, 5, std::less<uint32_t>, 4> largest;
+				for (uint32_t i = 0; i<100; i++) {
+					const uint32_t value = (i * 37) % 101;
+					if ( !largest.isFull() )  largest.push( value );
+					else if ( value > *largest.peek() )  largest.replaceTop( value );
+				}
+				uint32_t value;
+				for (uint32_t expected : { 96, 97, 98, 99, 100 }) {
+					assertTrue( largest.pop(&value) );
+					assertEquals( expected, value );
+				}
+
+				// Largest first, using std::greater
+				PriorityQueue<uint32_t, 4, std::greater<uint32_t>> queue;
+				queue.replaceTop( 3 );
+				queue.push( 8 );
+				queue.push( 1 );
+				assertEquals( 8, *queue.peek() );
+			}
+
+			template void PriorityQueueTest::performTest_Ordering<2>();
+			template void PriorityQueueTest::performTest_Ordering<4>();
+
+		} /* namespace StaticMemory */
+	} /* namespace Lists */
+} /* namespace Util */
@@ -0,0 +1,42 @@
+/*
+ * PriorityQueueTest.h
+ *
+ *  Created on: 16.10.2026
+ *      Author: agent
+ *
+ *  Description:
+ *  	Tests for priority queue.
+ */
+
+#ifndef UTIL_LISTS_STATICMEMORY_TEST_PRIORITY_QUEUE_TEST_H_
+#define UTIL_LISTS_STATICMEMORY_TEST_PRIORITY_QUEUE_TEST_H_
+
+#include <stdint-gcc.h>
+
+
+namespace Util {
+	namespace Lists {
+		namespace StaticMemory {
+
+			class PriorityQueueTest {
+					PriorityQueueTest() = delete;
+
+				public:
+					static void performAllTests();
+
+				private:
+					static void assertTrue( bool value );
+					static void assertEquals( uint32_t expected, uint32_t value );
+
+					template <uint_fast8_t Arity>
+					static void performTest_Ordering();
+					static void performTest_Handles();
+					static void performTest_TopK();
+
+			};
+
+		} /* namespace StaticMemory */
+	} /* namespace Lists */
+} /* namespace Util */
+
+#endif /* UTIL_LISTS_STATICMEMORY_TEST_PRIORITY_QUEUE_TEST_H_ */
@@ -0,0 +1,195 @@
+/*
+ * RecordFifoTest.cpp
+ *
+ *  Created on: 16.10.2026
+ *      Author: agent
+ *
+ *  Description:
+ *  	Tests for variable-length record circular buffer. The stress test uses two threads and thus needs to be
+ *  	run on the (Linux) host.
+ */
+
+#include "../RecordFifo.h"
+#include "RecordFifoTest.h"
+
+#include <string.h>
+#include <thread>
+
+
+namespace Util {
+	namespace Lists {
+		namespace StaticMemory {
+
+			namespace {
+				/// Fills a record with a pattern that depends on its sequence number and size.
+				void fillRecord( uint8_t *payload, uint32_t sequenceNumber, uint32_t size ) {
+					for (uint32_t i = 0; i<size; i++)  payload[i] = static_cast<uint8_t>( sequenceNumber * 7 + i );
+				}
+
+				bool checkRecord( const uint8_t *payload, uint32_t sequenceNumber, uint32_t size ) {
+					for (uint32_t i = 0; i<size; i++)
+						if ( payload[i] != static_cast<uint8_t>(sequenceNumber * 7 + i) )  return false;
+					return true;
+				}
+			}
+
+
+			void RecordFifoTest::assertTrue( bool value ) {
+				if ( !value )  while(1){}
+			}
+
+			void RecordFifoTest::assertEquals( uint32_t expected, uint32_t value ) {
+				if ( expected != value )  while(1){}
+			}
+
+
+			void RecordFifoTest::performAllTests() {
+				performTest_WriteAndRead();
+				performTest_ZeroCopy();
+				performTest_Wraparound();
+				performTest_TwoThreadStress();
+			}
+
+			void RecordFifoTest::performTest_WriteAndRead() {
+				RecordFifo<64> fifo;
+				char line[32];
+				uint16_t size;
+
+				assertTrue( fifo.isEmpty() );
+				assertTrue( fifo.peek(&size) == nullptr );
+				assertTrue( !fifo.release() );
+				assertEquals( 30, fifo.maxRecordSize() );
+
+				assertTrue( fifo.write("hello", 5) );
+				assertTrue( fifo.write("", 0) );
+				assertTrue( fifo.write("world!", 6) );
+				assertTrue( !fifo.isEmpty() );
+
+				// Each record takes its size (rounded up to 2 bytes) plus a 2-byte header: 8 + 2 + 8 + 42 bytes
+				assertTrue( fifo.write("0123456789012345678901234567890123456789", 40) );
+				assertTrue( !fifo.write("xyz", 3) );  // --> Only 4 bytes left, and wrapping around isn't possible yet
+
+				assertTrue( fifo.read(line, sizeof(line), &size) );
+				assertEquals( 5, size );
+				assertTrue( memcmp(line, "hello", 5) == 0 );
+				assertTrue( fifo.read(line, sizeof(line), &size) );
+				assertEquals( 0, size );
+				const uint8_t *record = fifo.peek( &size );
+				assertEquals( 6, size );
+				assertTrue( memcmp(record, "world!", 6) == 0 );
+				assertTrue( fifo.release() );
+
+				assertTrue( !fifo.read(line, sizeof(line), &size) );  // --> The destination is too small; the record is kept
+				assertTrue( fifo.peek(&size) != nullptr );
+				assertEquals( 40, size );
+
+				fifo.clear();
+				assertTrue( fifo.isEmpty() );
+			}
+
+			void RecordFifoTest::performTest_ZeroCopy() {
+				RecordFifo<32, uint8_t> fifo;
+				uint8_t size = 0;
+
+				// Reserve generously, commit what was actually written
+				uint8_t *payload = fifo.reserve( 20 );
+				assertTrue( payload != nullptr );
+				memcpy( payload, "abc", 3 );
+				assertTrue( fifo.isEmpty() );  // --> Not visible before committing
+				fifo.commit( 3 );
+
+				// An abandoned reservation doesn't publish anything
+				assertTrue( fifo.reserve(10) != nullptr );
+				assertTrue( fifo.reserve(28) == nullptr );  // --> 4 + 29 bytes do not fit
+				fifo.commit( 5 );
+
+				const uint8_t *record = fifo.peek( &size );
+				assertEquals( 3, size );
+				assertTrue( memcmp(record, "abc", 3) == 0 );
+				assertTrue( fifo.release() );
+				assertTrue( fifo.isEmpty() );
+			}
+
+			void RecordFifoTest::performTest_Wraparound() {
+				static RecordFifo<100> fifo;
+				uint32_t writtenCount = 0, readCount = 0;
+				uint16_t size;
+
+				// Records of varying size; some of them need to be placed at the beginning of the buffer
+				for (uint32_t round = 0; round<2000; round++) {
+					const uint32_t recordSize = (round * 13) % (fifo.maxRecordSize() + 1);
+					uint8_t *payload = fifo.reserve( recordSize );
+					if ( payload ) {
+						assertTrue( payload + recordSize <= reinterpret_cast<const uint8_t*>(&fifo) + fifo.capacity() );  // --> Never split
+						fillRecord( payload, writtenCount, recordSize );
+						fifo.commit( recordSize );
+						writtenCount++;
+					}
+					if ( round % 3 != 0 ) {
+						const uint8_t *record = fifo.peek( &size );
+						if ( record ) {
+							assertTrue( checkRecord(record, readCount, size) );
+							fifo.release();
+							readCount++;
+						}
+					}
+				}
+				while ( const uint8_t *record = fifo.peek(&size) ) {
+					assertTrue( checkRecord(record, readCount, size) );
+					fifo.release();
+					readCount++;
+				}
+				assertTrue( writtenCount > 1000 );
+				assertEquals( writtenCount, readCount );
+
+				// Any record up to maxRecordSize() fits into an empty buffer, wherever the indices are
+				for (uint32_t offset = 0; offset<50; offset++) {
+					assertTrue( fifo.write("..", offset % 3) );
+					assertTrue( fifo.release() );
+					assertTrue( fifo.reserve(fifo.maxRecordSize()) != nullptr );
+				}
+			}
+
+			/**
+			 * The producer thread writes records of varying sizes as fast as possible; the consumer thread checks that
+			 * no record is lost, duplicated or torn.
+			 */
+			void RecordFifoTest::performTest_TwoThreadStress() {
+				static RecordFifo<256> fifo;
+				constexpr uint32_t RecordCount = 1000000;
+
+				std::thread producer( [](){
+					for (uint32_t i = 0; i<RecordCount; ) {
+						const uint32_t size = (i * 31) % 100;
+						uint8_t *payload = fifo.reserve( size );
+						if ( payload ) {
+							fillRecord( payload, i, size );
+							fifo.commit( size );
+							i++;
+						} else {
+							std::this_thread::yield();
+						}
+					}
+				} );
+
+				bool recordsAreCorrect = true;
+				for (uint32_t i = 0; i<RecordCount; ) {
+					uint16_t size;
+					const uint8_t *record = fifo.peek( &size );
+					if ( record ) {
+						if ( size != (i * 31) % 100  ||  !checkRecord(record, i, size) )  recordsAreCorrect = false;
+						fifo.release();
+						i++;
+					} else {
+						std::this_thread::yield();
+					}
+				}
+				producer.join();
+
+				assertTrue( recordsAreCorrect );
+				assertTrue( fifo.isEmpty() );
+			}
+
+		} /* namespace StaticMemory */
+	} /* namespace Lists */
+} /* namespace Util */
@@ -0,0 +1,42 @@
+/*
+ * RecordFifoTest.h
+ *
+ *  Created on: 16.10.2026
+ *      Author: agent
+ *
+ *  Description:
+ *  	Tests for variable-length record circular buffer.
+ */
+
+#ifndef UTIL_LISTS_STATICMEMORY_TEST_RECORD_FIFO_TEST_H_
+#define UTIL_LISTS_STATICMEMORY_TEST_RECORD_FIFO_TEST_H_
+
+#include <stdint-gcc.h>
+
+
+namespace Util {
+	namespace Lists {
+		namespace StaticMemory {
+
+			class RecordFifoTest {
+					RecordFifoTest() = delete;
+
+				public:
+					static void performAllTests();
+
+				private:
+					static void assertTrue( bool value );
+					static void assertEquals( uint32_t expected, uint32_t value );
+
+					static void performTest_WriteAndRead();
+					static void performTest_ZeroCopy();
+					static void performTest_Wraparound();
+					static void performTest_TwoThreadStress();
+
+			};
+
+		} /* namespace StaticMemory */
+	} /* namespace Lists */
+} /* namespace Util */
+
+#endif /* UTIL_LISTS_STATICMEMORY_TEST_RECORD_FIFO_TEST_H_ */
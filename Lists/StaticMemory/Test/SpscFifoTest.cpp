@@ -0,0 +1,119 @@
+/*
+ * SpscFifoTest.cpp
+ *
+ *  Created on: 16.10.2026
+ *      Author: agent
+ *
+ *  Description:
+ *  	Tests for lock-free single-producer/single-consumer circular buffer. The stress test uses two
+ *  	threads and thus needs to be run on the (Linux) host.
+ */
+
+#include "../SpscFifo.h"
+#include "SpscFifoTest.h"
+
+#include <thread>
+
+
+namespace Util {
+	namespace Lists {
+		namespace StaticMemory {
+
+			void SpscFifoTest::assertTrue( bool value ) {
+				if ( !value )  while(1){}
+			}
+
+			void SpscFifoTest::assertEquals( uint32_t expected, uint32_t value ) {
+				if ( expected != value )  while(1){}
+			}
+
+
+			void SpscFifoTest::performAllTests() {
+				performTest_FillAndDrain();
+				performTest_Wraparound();
+				performTest_TwoThreadStress();
+			}
+
+			void SpscFifoTest::performTest_FillAndDrain() {
+				SpscFifo<uint32_t, 4> fifo;
+				uint32_t value = 0;
+
+				assertTrue( fifo.isEmpty() );
+				assertTrue( !fifo.dequeue(&value) );
+				assertTrue( fifo.peek() == nullptr );
+
+				for (uint32_t i = 1; i<=4; i++)  assertTrue( fifo.enqueue(i) );
+				assertTrue( fifo.isFull() );
+				assertEquals( 4, fifo.Count() );
+				assertEquals( 0, fifo.freeElementCount() );
+				assertTrue( !fifo.enqueue(5) );
+
+				assertEquals( 1, *fifo.peek() );
+				for (uint32_t i = 1; i<=4; i++) {
+					assertTrue( fifo.dequeue(&value) );
+					assertEquals( i, value );
+				}
+				assertTrue( fifo.isEmpty() );
+				assertEquals( 0, fifo.Count() );
+			}
+
+			void SpscFifoTest::performTest_Wraparound() {
+				SpscFifo<uint32_t, 3> fifo;
+				uint32_t value = 0;
+
+				for (uint32_t i = 0; i<20; i++) {
+					assertTrue( fifo.enqueue(i) );
+					if ( i % 2 )  {
+						assertTrue( fifo.enqueue(100 + i) );
+						assertEquals( 2, fifo.Count() );
+						fifo.dequeue( &value );  assertEquals( i, value );
+						fifo.dequeue( &value );  assertEquals( 100 + i, value );
+					} else {
+						assertEquals( 1, fifo.Count() );
+						fifo.dequeue( &value );  assertEquals( i, value );
+					}
+				}
+
+				fifo.enqueue( 1 );  fifo.enqueue( 2 );
+				fifo.clear();
+				assertTrue( fifo.isEmpty() );
+			}
+
+			/**
+			 * The producer thread enqueues an ascending sequence as fast as possible; the consumer thread checks that
+			 * no element is lost, duplicated or torn.
+			 */
+			void SpscFifoTest::performTest_TwoThreadStress() {
+				struct Element {
+					uint32_t sequenceNumber;
+					uint32_t complement;
+				};
+				static SpscFifo<Element, 64> fifo;
+				constexpr uint32_t ElementCount = 2000000;
+
+				std::thread producer( [](){
+					for (uint32_t i = 0; i<ElementCount; ) {
+						if ( fifo.enqueue(Element{ i, ~i }) )  i++;
+						else                                   std::this_thread::yield();
+					}
+				} );
+
+				bool orderIsCorrect = true;
+				for (uint32_t i = 0; i<ElementCount; ) {
+					Element element;
+					if ( fifo.dequeue(&element) ) {
+						if ( element.sequenceNumber != i  ||  element.complement != ~i )  orderIsCorrect = false;
+						i++;
+					} else {
+						std::this_thread::yield();
+					}
+				}
+				producer.join();
+
+				assertTrue( orderIsCorrect );
+				assertTrue( fifo.isEmpty() );
+			}
+
+		} /* namespace StaticMemory */
+	} /* namespace Lists */
+} /* namespace Util */
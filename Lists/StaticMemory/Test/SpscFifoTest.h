@@ -0,0 +1,42 @@
+/*
+ * SpscFifoTest.h
+ *
+ *  Created on: 16.10.2026
+ *      Author: agent
+ *
+ *  Description:
+ *  	Tests for lock-free single-producer/single-consumer circular buffer. The stress test uses two
+ *  	threads and thus needs to be run on the (Linux) host.
+ */
+
+#ifndef UTIL_LISTS_STATICMEMORY_TEST_SPSC_FIFO_TEST_H_
+#define UTIL_LISTS_STATICMEMORY_TEST_SPSC_FIFO_TEST_H_
+
+#include <stdint-gcc.h>
+
+
+namespace Util {
+	namespace Lists {
+		namespace StaticMemory {
+
+			class SpscFifoTest {
+					SpscFifoTest() = delete;
+
+				public:
+					static void performAllTests();
+
+				private:
+					static void assertTrue( bool value );
+					static void assertEquals( uint32_t expected, uint32_t value );
+
+					static void performTest_FillAndDrain();
+					static void performTest_Wraparound();
+					static void performTest_TwoThreadStress();
+
+			};
+
+		} /* namespace StaticMemory */
+	} /* namespace Lists */
+} /* namespace Util */
+
+#endif /* UTIL_LISTS_STATICMEMORY_TEST_SPSC_FIFO_TEST_H_ */
@@ -0,0 +1,129 @@
+/*
+ * TripleBufferTest.cpp
+ *
+ *  Created on: 16.10.2026
+ *      Author: agent
+ *
+ *  Description:
+ *  	Tests for wait-free triple buffer mailbox. The torn-read test uses two threads and thus needs to be run
+ *  	on the (Linux) host.
+ */
+
+#include "../TripleBuffer.h"
+#include "TripleBufferTest.h"
+
+#include <atomic>
+#include <thread>
+
+
+namespace Util {
+	namespace Lists {
+		namespace StaticMemory {
+
+			namespace {
+				/// Snapshot whose fields all depend on its sequence number, so that torn values can be detected.
+				struct Snapshot {
+					uint32_t sequenceNumber;
+					uint32_t samples[15];
+
+					void fill( uint32_t number ) {
+						sequenceNumber = number;
+						for (uint32_t i = 0; i<15; i++)  samples[i] = number * 31 + i;
+					}
+
+					bool isConsistent() const {
+						for (uint32_t i = 0; i<15; i++)
+							if ( samples[i] != sequenceNumber * 31 + i )  return false;
+						return true;
+					}
+				};
+			}
+
+
+			void TripleBufferTest::assertTrue( bool value ) {
+				if ( !value )  while(1){}
+			}
+
+			void TripleBufferTest::assertEquals( uint32_t expected, uint32_t value ) {
+				if ( expected != value )  while(1){}
+			}
+
+
+			void TripleBufferTest::performAllTests() {
+				performTest_LatestValue();
+				performTest_TwoThreadTornRead();
+			}
+
+			void TripleBufferTest::performTest_LatestValue() {
+				TripleBuffer<uint32_t> mailbox;
+				uint32_t value = 99;
+
+				assertTrue( !mailbox.hasNewData() );
+				assertTrue( !mailbox.fetch() );
+				assertTrue( !mailbox.read(&value) );
+				assertEquals( 0, value );  // --> Value-initialized
+
+				mailbox.write( 1 );
+				assertTrue( mailbox.hasNewData() );
+				assertTrue( mailbox.read(&value) );
+				assertEquals( 1, value );
+				assertTrue( !mailbox.read(&value) );  // --> No new value, but the latest one is still available
+				assertEquals( 1, value );
+
+				// Stale values are overwritten; the writer never blocks
+				for (uint32_t i = 2; i<=10; i++) {
+					mailbox.writeBuffer() = i;
+					mailbox.publish();
+				}
+				assertTrue( mailbox.fetch() );
+				assertEquals( 10, mailbox.readBuffer() );
+				assertTrue( !mailbox.fetch() );
+				assertEquals( 10, mailbox.readBuffer() );
+
+				// The reader's buffer stays untouched while the writer continues
+				mailbox.write( 11 );
+				mailbox.write( 12 );
+				assertEquals( 10, mailbox.readBuffer() );
+				assertTrue( mailbox.fetch() );
+				assertEquals( 12, mailbox.readBuffer() );
+			}
+
+			/**
+			 * The writer thread publishes snapshots as fast as possible; the reader thread checks that each fetched
+			 * snapshot is complete and newer than the previous one.
+			 */
+			void TripleBufferTest::performTest_TwoThreadTornRead() {
+				static TripleBuffer<Snapshot> mailbox;
+				constexpr uint32_t SnapshotCount = 2000000;
+				std::atomic<bool> writerIsDone( false );
+
+				std::thread writer( [&writerIsDone](){
+					for (uint32_t i = 1; i<=SnapshotCount; i++) {
+						mailbox.writeBuffer().fill( i );
+						mailbox.publish();
+					}
+					writerIsDone.store( true );
+				} );
+
+				bool snapshotsAreConsistent = true;
+				uint32_t previousSequenceNumber = 0, fetchCount = 0;
+				while ( true ) {
+					const bool isDone = writerIsDone.load();
+					if ( mailbox.fetch() ) {
+						const Snapshot &snapshot = mailbox.readBuffer();
+						if ( !snapshot.isConsistent()  ||  snapshot.sequenceNumber <= previousSequenceNumber )  snapshotsAreConsistent = false;
+						previousSequenceNumber = snapshot.sequenceNumber;
+						fetchCount++;
+					}
+					if ( isDone  &&  !mailbox.hasNewData() )  break;
+				}
+				writer.join();
+
+				assertTrue( snapshotsAreConsistent );
+				assertEquals( SnapshotCount, previousSequenceNumber );  // --> The last value is never lost
+				assertTrue( fetchCount > 1 );
+			}
+
+		} /* namespace StaticMemory */
+	} /* namespace Lists */
+} /* namespace Util */
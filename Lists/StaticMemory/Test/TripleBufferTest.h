@@ -0,0 +1,40 @@
+/*
+ * TripleBufferTest.h
+ *
+ *  Created on: 16.10.2026
+ *      Author: agent
+ *
+ *  Description:
+ *  	Tests for wait-free triple buffer mailbox.
+ */
+
+#ifndef UTIL_LISTS_STATICMEMORY_TEST_TRIPLE_BUFFER_TEST_H_
+#define UTIL_LISTS_STATICMEMORY_TEST_TRIPLE_BUFFER_TEST_H_
+
+#include <stdint-gcc.h>
+
+
+namespace Util {
+	namespace Lists {
+		namespace StaticMemory {
+
+			class TripleBufferTest {
+					TripleBufferTest() = delete;
+
+				public:
+					static void performAllTests();
+
+				private:
+					static void assertTrue( bool value );
+					static void assertEquals( uint32_t expected, uint32_t value );
+
+					static void performTest_LatestValue();
+					static void performTest_TwoThreadTornRead();
+
+			};
+
+		} /* namespace StaticMemory */
+	} /* namespace Lists */
+} /* namespace Util */
+
+#endif /* UTIL_LISTS_STATICMEMORY_TEST_TRIPLE_BUFFER_TEST_H_ */
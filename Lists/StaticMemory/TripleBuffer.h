@@ -0,0 +1,136 @@
+/*
+ * TripleBuffer.h
+ *
+ *  Created on: 16.10.2026
+ *      Author: agent
+ *
+ *  Description:
+ *    This class contains a wait-free "latest value" mailbox for exactly one writer and one reader, e.g. for handing
+ *    sensor snapshots from an ISR to the main loop. Only the most recent value matters: The writer never blocks
+ *    and may overwrite values the reader hasn't seen yet; the reader always gets the most recent complete value.
+ *
+ *    There are three buffers: one owned by the writer, one owned by the reader, and one in between. Publishing
+ *    swaps the writer's buffer with the one in between; fetching swaps the reader's buffer with it. Both swaps are
+ *    a single atomic exchange, so neither side ever waits for the other one and no value gets torn.
+ *
+ *      sensorMailbox.writeBuffer() = sample;  sensorMailbox.publish();      // Writer (e.g. ISR)
+ *      if ( sensorMailbox.fetch() )  process( sensorMailbox.readBuffer() ); // Reader (e.g. main loop)
+ *
+ *    Further information:
+ *      - no usage of dynamic memory,
+ *      - no Mutex necessary: Interrupts never get disabled,
+ *      - the writer may fill its buffer in place, there is no intermediate copy,
+ *      - only writeBuffer(), publish() and write() may be called by the writer; fetch(), readBuffer(), read() and
+ *        hasNewData() may be called by the reader,
+ *      - requires atomic exchange (not available on Cortex-M0/M0+).
+ */
+#ifndef APPLICATION_USER_LISTS_STATICMEMORY_TRIPLEBUFFER_H_
+#define APPLICATION_USER_LISTS_STATICMEMORY_TRIPLEBUFFER_H_
+
+
+#include <stdint-gcc.h>
+#include <stddef.h>
+#include <array>
+#include <atomic>
+#include <type_traits>
+
+namespace Util {
+	namespace Lists {
+		namespace StaticMemory {
+
+			template <typename T>
+			class TripleBuffer {
+				static_assert( std::is_default_constructible<T>::value, "T must be default-constructible!" );
+
+				private:
+					/// The buffer in between is encoded in the lower bits; NewDataFlag tells that the writer published it and the reader hasn't fetched it yet.
+					static constexpr uint8_t IndexMask   = 0x03;
+					static constexpr uint8_t NewDataFlag = 0x04;
+
+				public:
+
+					TripleBuffer() : m_buffers(), m_writeIndex(0), m_readIndex(1), m_middle(2) {}
+
+					TripleBuffer( const TripleBuffer& ) = delete;
+					TripleBuffer& operator=( const TripleBuffer& ) = delete;
+
+					/**
+					 * Returns the writer's buffer, which may be filled in place. Must only be called by the writer.
+					 *
+					 * @remark The buffer's content is undefined (an older value); it should be overwritten completely.
+					 */
+					inline T& writeBuffer() {
+						return m_buffers[m_writeIndex];
+					}
+
+					/**
+					 * Publishes the writer's buffer as the most recent value. Must only be called by the writer.
+					 */
+					void publish() {
+						const uint8_t previousMiddle = m_middle.exchange( static_cast<uint8_t>(m_writeIndex | NewDataFlag), std::memory_order_acq_rel );
+						m_writeIndex = previousMiddle & IndexMask;  // --> Either a stale value, or one the reader has finished with.
+					}
+
+					/**
+					 * Copies a value into the writer's buffer and publishes it. Must only be called by the writer.
+					 */
+					void write( const T& value ) {
+						writeBuffer() = value;
+						publish();
+					}
+
+					/**
+					 * Returns if a value has been published which the reader hasn't fetched yet.
+					 */
+					inline bool hasNewData() const {
+						return (m_middle.load(std::memory_order_relaxed) & NewDataFlag) != 0;
+					}
+
+					/**
+					 * Makes the most recent value available by @see readBuffer(). Must only be called by the reader.
+					 *
+					 * @return                	..	Returns if there was a new value. Otherwise, the reader's buffer stays unchanged.
+					 */
+					bool fetch() {
+						if ( !hasNewData() )  return false;
+						const uint8_t previousMiddle = m_middle.exchange( m_readIndex, std::memory_order_acq_rel );
+						m_readIndex = previousMiddle & IndexMask;
+						return true;
+					}
+
+					/**
+					 * Returns the reader's buffer, i.e. the value fetched last. It stays unchanged until the next call of
+					 * @see fetch(). Must only be called by the reader.
+					 *
+					 * @remark Before the first successful fetch, the buffer contains a value-initialized T.
+					 */
+					inline const T& readBuffer() const {
+						return m_buffers[m_readIndex];
+					}
+
+					/**
+					 * Fetches and copies the most recent value. Must only be called by the reader.
+					 *
+					 * @param copyDestination 	..	Receives the most recent value, even if it was read before.
+					 * @return                	..	Returns if the value is new since the last call.
+					 */
+					bool read( T *copyDestination ) {
+						const bool isNew = fetch();
+						*copyDestination = readBuffer();
+						return isNew;
+					}
+
+
+				private:
+					std::array<T, 3>      m_buffers;
+					uint8_t               m_writeIndex;   ///< Buffer owned by the writer.
+					uint8_t               m_readIndex;    ///< Buffer owned by the reader.
+					std::atomic<uint8_t>  m_middle;       ///< Buffer in between (plus NewDataFlag). Exchanged by both sides.
+
+			}; /* class */
+
+		} /*namespace StaticMemory*/
+	} /* namespace Lists */
+} /* namespace Util */
+
+#endif /* APPLICATION_USER_LISTS_STATICMEMORY_TRIPLEBUFFER_H_ */
@@ -5,18 +5,23 @@
  *      Author: Robert Voelckner
  *
  *  Description:
- *    Implements the MutexBase class. Prevents all ARM Cortex-M interrupts (except for NMI and hard fault) from being executed.
+ *    Implements a lock policy (@see LockPolicy.h). Prevents all ARM Cortex-M interrupts (except for NMI and hard fault) from being executed.
  *    Important: Enabling/disabling interrupts can only performed by software which runs in privileged mode.
+ *
+ *    Locked sections may be nested; the PRIMASK state of the outermost one is restored upon leaving it. An interrupt
+ *    can only enter a locked section while none is active, so the shared nesting state is never interrupted.
  */
 #ifndef APPLICATION_USER_UTIL_MUTEX_ARMINTERRUPTPREVENTIONMUTEX_H_
 #define APPLICATION_USER_UTIL_MUTEX_ARMINTERRUPTPREVENTIONMUTEX_H_
 
 
-#include "MutexBase.h"
+#include <stdint-gcc.h>
 
 
 #ifdef __GNUC__
-	#include <cmsis_gcc.h>
+	#ifndef __CMSIS_GCC_H  // --> Not included yet (or provided by a host-side stub, @see Test/CmsisStub/cmsis_gcc.h)
+		#include <cmsis_gcc.h>
+	#endif
 #else
 	#error Take precautions to include CMSIS here!
 #endif
@@ -24,7 +29,7 @@
 namespace Util {
 	namespace Mutex {
 
-		class ArmInterruptPreventionMutex : public MutexBase {
+		class ArmInterruptPreventionMutex {
 
 				/// The following switch defines if, upon releasing the Mutex, the previous state shall be restored. If not,
 				/// the interrupts will just be enabled again - with no regard to whether they were or were not enabled before.
@@ -34,29 +39,44 @@ namespace Util {
 					static constexpr bool RestorePreviousState = ARM_INTERRUPT_PREVENTION_MUTEX__RESTORE_PREVIOUS_STATE;
 				#endif
 
+				/// Number of nested locked sections. Only modified while interrupts are disabled.
+				static inline uint32_t& nestingDepth() {
+					static uint32_t depth = 0;
+					return depth;
+				}
 
-				uint32_t _previousPrimaskState;
+				/// PRIMASK state before entering the outermost locked section.
+				static inline uint32_t& previousPrimaskState() {
+					static uint32_t state = 0;
+					return state;
+				}
 
 			public:
-				ArmInterruptPreventionMutex() {
+				static inline void lock() {
 					if ( RestorePreviousState ) {
-						_previousPrimaskState = __get_PRIMASK();
+						const uint32_t primaskState = __get_PRIMASK();
+						__disable_irq();
+						if ( nestingDepth()++ == 0 )  previousPrimaskState() = primaskState;
+					} else {
+						__disable_irq();
 					}
-					__disable_irq();
 				}
 
-				~ArmInterruptPreventionMutex() {
+				static inline void unlock() {
 					if ( RestorePreviousState ) {
-						/*bool interruptsWereDisabled = _previousPrimaskState & UINT32_C(1);
-						if ( interruptsWereDisabled )   __disable_irq();
-						else                            __enable_irq();*/
-						__set_PRIMASK(_previousPrimaskState);
+						if ( --nestingDepth() == 0 )  __set_PRIMASK( previousPrimaskState() );
 					}
 					else if ( !RestorePreviousState ) {
 						__enable_irq();
 					}
 				}
 
+				/// Disabling the interrupts always succeeds.
+				static inline bool try_lock() {
+					lock();
+					return true;
+				}
+
 		};
 
 	} /* namespace Mutex */
@@ -0,0 +1,122 @@
+/*
+ * ArmPriorityCeilingMutex.h
+ *
+ *  Created on: 16.10.2026
+ *      Author: agent
+ *
+ *  Description:
+ *    Implements a lock policy (@see LockPolicy.h). Prevents only those ARM Cortex-M interrupts from being executed
+ *    which may access the protected resource, by raising BASEPRI to the resource's ceiling priority. Interrupts with
+ *    a higher priority (e.g. motor control) keep running, unlike with @see ArmInterruptPreventionMutex:
+ *
+ *      // The logging Fifo is used by the main loop and by ISRs with the priorities 5 and 7 --> Ceiling is 5
+ *      Fifo<LogEntry, false, 64, ArmPriorityCeilingMutex<5>> logFifo;
+ *
+ *    The ceiling is the priority number (as given to NVIC_SetPriority(); with HAL_NVIC_SetPriority() and
+ *    NVIC_PRIORITYGROUP_4, the preemption priority) of the most urgent interrupt accessing the resource, i.e. the
+ *    numerically lowest one. While locked, all interrupts with the same or a numerically higher number are deferred.
+ *    Important: Writing BASEPRI can only be performed by software which runs in privileged mode. Not available on
+ *    Cortex-M0/M0+ (ARMv6-M), which have no BASEPRI.
+ *
+ *    Locked sections may be nested, also with differing ceilings, as long as they are left in reverse order (as
+ *    guards do). BASEPRI never gets lowered by locking, and the value before the outermost locked section of each
+ *    ceiling is restored upon leaving it.
+ *
+ *    Cortex-M7 r0p1 (e.g. early STM32F7 revisions) is affected by ARM erratum 837070: Raising BASEPRI may not take
+ *    effect immediately, so an interrupt at or below the ceiling could still enter the locked section. Define
+ *    ARM_PRIORITY_CEILING_MUTEX__CM7_R0P1_WORKAROUND as true for these devices; interrupts are then disabled
+ *    briefly while BASEPRI gets written.
+ */
+#ifndef APPLICATION_USER_UTIL_MUTEX_ARMPRIORITYCEILINGMUTEX_H_
+#define APPLICATION_USER_UTIL_MUTEX_ARMPRIORITYCEILINGMUTEX_H_
+
+
+#include <stdint-gcc.h>
+
+
+#ifdef __GNUC__
+	#ifndef __CMSIS_GCC_H  // --> Not included yet (or provided by a host-side stub, @see Test/CmsisStub/cmsis_gcc.h)
+		#include <cmsis_gcc.h>
+	#endif
+#else
+	#error Take precautions to include CMSIS here!
+#endif
+
+#if defined(__ARM_ARCH_6M__)
+	#error Cortex-M0/M0+ have no BASEPRI register! Use ArmInterruptPreventionMutex instead.
+#endif
+
+namespace Util {
+	namespace Mutex {
+
+		template <uint8_t TCeilingPriority>
+		class ArmPriorityCeilingMutex {
+
+				/// Number of priority bits implemented by the NVIC. Taken from the device header if it was included before;
+				/// all STM32 with BASEPRI implement 4 bits.
+				#if defined ARM_PRIORITY_CEILING_MUTEX__PRIORITY_BITS
+					static constexpr uint32_t PriorityBits = ARM_PRIORITY_CEILING_MUTEX__PRIORITY_BITS;
+				#elif defined __NVIC_PRIO_BITS
+					static constexpr uint32_t PriorityBits = __NVIC_PRIO_BITS;
+				#else
+					static constexpr uint32_t PriorityBits = 4;
+				#endif
+
+				static_assert( TCeilingPriority > 0, "Priority 0 cannot be masked by BASEPRI! Use ArmInterruptPreventionMutex instead." );
+				static_assert( TCeilingPriority < (UINT32_C(1) << PriorityBits), "The ceiling exceeds the implemented priority levels!" );
+
+				/// The following switch enables ARM's workaround for erratum 837070 (Cortex-M7 r0p1): BASEPRI is written while
+				/// PRIMASK is set. Other cores don't need it.
+				#if not defined ARM_PRIORITY_CEILING_MUTEX__CM7_R0P1_WORKAROUND
+					static constexpr bool Cm7R0p1Workaround = false;
+				#else
+					static constexpr bool Cm7R0p1Workaround = ARM_PRIORITY_CEILING_MUTEX__CM7_R0P1_WORKAROUND;
+				#endif
+
+				/// The priority is stored in the most significant bits of BASEPRI.
+				static constexpr uint32_t CeilingValue = static_cast<uint32_t>(TCeilingPriority) << (8 - PriorityBits);
+
+				/// Number of nested locked sections. Only modified while all users are masked.
+				static inline uint32_t& nestingDepth() {
+					static uint32_t depth = 0;
+					return depth;
+				}
+
+				/// BASEPRI before entering the outermost locked section.
+				static inline uint32_t& previousBasepri() {
+					static uint32_t basepri = 0;
+					return basepri;
+				}
+
+			public:
+				static inline void lock() {
+					const uint32_t basepri = __get_BASEPRI();
+					if ( Cm7R0p1Workaround ) {
+						const uint32_t primaskState = __get_PRIMASK();  // --> Restored instead of just enabling, in case interrupts were disabled already
+						__disable_irq();
+						__set_BASEPRI_MAX( CeilingValue );
+						__set_PRIMASK( primaskState );
+					} else {
+						__set_BASEPRI_MAX( CeilingValue );  // --> Only raises the masking, never lowers it
+					}
+					__ISB();                                // --> Takes effect before entering the locked section
+					if ( nestingDepth()++ == 0 )  previousBasepri() = basepri;
+				}
+
+				static inline void unlock() {
+					if ( --nestingDepth() == 0 )  __set_BASEPRI( previousBasepri() );
+				}
+
+				/// Raising BASEPRI always succeeds.
+				static inline bool try_lock() {
+					lock();
+					return true;
+				}
+
+		};
+
+	} /* namespace Mutex */
+} /* namespace Util */
+
+
+#endif /* APPLICATION_USER_UTIL_MUTEX_ARMPRIORITYCEILINGMUTEX_H_ */
@@ -0,0 +1,98 @@
+/*
+ * FutexMutex.h
+ *
+ *  Created on: 16.10.2026
+ *      Author: agent
+ *
+ *  Description:
+ *    Implements a lock policy (@see LockPolicy.h) for Linux hosts as an adaptive lock based on futexes. A contended lock is
+ *    spun on for a short while first, since the locked sections of the containers are short. Only if it is still
+ *    taken, the thread sleeps in the kernel until it gets woken up by the unlocking thread. An uncontended lock
+ *    and unlock cost one atomic operation each, without a system call.
+ *
+ *    The lock word has three states (U. Drepper, "Futexes Are Tricky"): 0 = unlocked, 1 = locked, 2 = locked
+ *    and there may be sleeping threads. Only in state 2, unlocking needs to wake up a thread.
+ *
+ *    As with @see StdMutex, all users of the same type share one lock; use different tag types for different
+ *    resources.
+ */
+#ifndef APPLICATION_USER_UTIL_MUTEX_FUTEXMUTEX_H_
+#define APPLICATION_USER_UTIL_MUTEX_FUTEXMUTEX_H_
+
+
+#include <stdint-gcc.h>
+#include <atomic>
+
+#if defined(__linux__)
+	#include <linux/futex.h>
+	#include <sys/syscall.h>
+	#include <unistd.h>
+#else
+	#error Futexes are only available on Linux!
+#endif
+
+
+namespace Util {
+	namespace Mutex {
+
+		template <typename TTag = void>
+		class FutexMutex {
+
+				static constexpr uint32_t Unlocked = 0;
+				static constexpr uint32_t Locked = 1;
+				static constexpr uint32_t LockedWithWaiters = 2;
+
+				/// Number of attempts before going to sleep.
+				static constexpr uint32_t SpinCount = 100;
+
+				static_assert( sizeof(std::atomic<uint32_t>) == sizeof(uint32_t), "The lock word must be usable as futex!" );
+
+				struct alignas(64) Word {
+					std::atomic<uint32_t> state;
+				};
+				static Word Lock;
+
+				static inline int* futexAddress() {
+					return reinterpret_cast<int*>( &Lock.state );
+				}
+
+			public:
+				static void lock() {
+					if ( try_lock() )  return;
+					uint32_t state = Lock.state.load( std::memory_order_relaxed );
+
+					for (uint32_t i = 0; i<SpinCount  &&  state != LockedWithWaiters; i++) {
+						#if defined(__x86_64__) || defined(__i386__)
+							__builtin_ia32_pause();
+						#endif
+						state = Unlocked;
+						if ( Lock.state.compare_exchange_weak(state, Locked, std::memory_order_acquire, std::memory_order_relaxed) )  return;
+					}
+
+					// Announces a waiter. If the lock got released meanwhile, the exchange takes it (in state 2, which may cause one needless wake-up).
+					while ( Lock.state.exchange(LockedWithWaiters, std::memory_order_acquire) != Unlocked ) {
+						syscall( SYS_futex, futexAddress(), FUTEX_WAIT_PRIVATE, static_cast<int>(LockedWithWaiters), nullptr, nullptr, 0 );
+					}
+				}
+
+				static inline void unlock() {
+					if ( Lock.state.exchange(Unlocked, std::memory_order_release) == LockedWithWaiters ) {
+						syscall( SYS_futex, futexAddress(), FUTEX_WAKE_PRIVATE, 1, nullptr, nullptr, 0 );
+					}
+				}
+
+				static inline bool try_lock() {
+					uint32_t state = Unlocked;
+					return Lock.state.compare_exchange_strong( state, Locked, std::memory_order_acquire, std::memory_order_relaxed );
+				}
+
+		};
+
+		template <typename TTag>
+		typename FutexMutex<TTag>::Word FutexMutex<TTag>::Lock = { {0} };
+
+	} /* namespace Mutex */
+} /* namespace Util */
+
+
+#endif /* APPLICATION_USER_UTIL_MUTEX_FUTEXMUTEX_H_ */
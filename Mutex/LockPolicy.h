@@ -0,0 +1,112 @@
+/*
+ * LockPolicy.h
+ *
+ *  Created on: 16.10.2026
+ *      Author: agent
+ *
+ *  Description:
+ *    Compile-time concept for the Mutex implementations (lock policies) used by the containers, plus scoped guards.
+ *
+ *    A lock policy is a class providing the static functions
+ *      - void lock():      Enters the locked section, waiting if necessary,
+ *      - void unlock():    Leaves the locked section,
+ *      - bool try_lock():  Enters the locked section if possible without waiting, and returns if it did.
+ *
+ *    There are no objects involved, thus no virtual functions, no vptr and no state on the stack. Policies without
+ *    locking (e.g. @see NoMutex) vanish completely after inlining. Since static functions may be called on objects,
+ *    each policy is a BasicLockable/Lockable type in the sense of the standard library as well:
+ *
+ *      StdMutex<> policy;
+ *      std::lock_guard<StdMutex<>> guard( policy );
+ *
+ *    Further information:
+ *      - locked sections are entered using @see LockGuard (or @see TryLockGuard),
+ *      - all users of the same policy type share one lock. Use different policy types (e.g. different tags) for
+ *        independent resources,
+ *      - @see IsLockPolicy rejects non-conforming types at compile time.
+ */
+#ifndef APPLICATION_USER_UTIL_MUTEX_LOCKPOLICY_H_
+#define APPLICATION_USER_UTIL_MUTEX_LOCKPOLICY_H_
+
+
+#include <type_traits>
+
+
+namespace Util {
+	namespace Mutex {
+
+		/**
+		 * Tells if a type conforms to the lock policy concept, i.e. provides static lock(), unlock() and try_lock().
+		 */
+		template <typename TPolicy>
+		class IsLockPolicy {
+				// Calling a non-static member function without an object is ill-formed, thus only static functions match.
+				template <typename T>
+				static auto check( int ) -> decltype( T::lock(), T::unlock(), std::is_convertible<decltype(T::try_lock()), bool>() );
+
+				template <typename>
+				static std::false_type check( ... );
+
+			public:
+				static constexpr bool value = decltype( check<TPolicy>(0) )::value;
+		};
+
+
+		/**
+		 * Locks the policy for its own lifetime.
+		 */
+		template <typename TPolicy>
+		class LockGuard {
+				static_assert( IsLockPolicy<TPolicy>::value, "The given Mutex type must provide static lock(), unlock() and try_lock()! @see Mutex/LockPolicy.h" );
+
+			public:
+				LockGuard() {
+					TPolicy::lock();
+				}
+
+				~LockGuard() {
+					TPolicy::unlock();
+				}
+
+				LockGuard( const LockGuard& ) = delete;
+				LockGuard& operator=( const LockGuard& ) = delete;
+		};
+
+
+		/**
+		 * Tries to lock the policy without waiting. If successful, it stays locked for the guard's lifetime:
+		 *
+		 *   TryLockGuard<StdMutex<>> guard;
+		 *   if ( guard )  doSomething();
+		 */
+		template <typename TPolicy>
+		class TryLockGuard {
+				static_assert( IsLockPolicy<TPolicy>::value, "The given Mutex type must provide static lock(), unlock() and try_lock()! @see Mutex/LockPolicy.h" );
+
+			public:
+				TryLockGuard() : m_ownsLock( TPolicy::try_lock() ) {}
+
+				~TryLockGuard() {
+					if ( m_ownsLock )  TPolicy::unlock();
+				}
+
+				TryLockGuard( const TryLockGuard& ) = delete;
+				TryLockGuard& operator=( const TryLockGuard& ) = delete;
+
+				inline bool ownsLock() const {
+					return m_ownsLock;
+				}
+
+				explicit operator bool() const {
+					return m_ownsLock;
+				}
+
+			private:
+				const bool m_ownsLock;
+		};
+
+	} /* namespace Mutex */
+} /* namespace Util */
+
+
+#endif /* APPLICATION_USER_UTIL_MUTEX_LOCKPOLICY_H_ */
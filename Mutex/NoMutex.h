@@ -5,7 +5,7 @@
  *      Author: Robert Voelckner
  *
  *  Description:
- *    Implements the MutexBase class. No special Mutex actions will be done here.
+ *    Implements a lock policy (@see LockPolicy.h). No special Mutex actions will be done here.
  */
 #ifndef APPLICATION_USER_UTIL_MUTEX_NOMUTEX_H_
 #define APPLICATION_USER_UTIL_MUTEX_NOMUTEX_H_
@@ -14,8 +14,12 @@
 namespace Util {
 	namespace Mutex {
 
-		class NoMutex : public MutexBase {
-			// Nothing happens in here
+		class NoMutex {
+			public:
+				// Nothing happens in here; after inlining, no code remains.
+				static inline void lock() {}
+				static inline void unlock() {}
+				static inline bool try_lock()  { return true; }
 		};
 
 	} /* namespace Mutex */
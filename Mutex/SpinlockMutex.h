@@ -0,0 +1,84 @@
+/*
+ * SpinlockMutex.h
+ *
+ *  Created on: 16.10.2026
+ *      Author: agent
+ *
+ *  Description:
+ *    Implements a lock policy (@see LockPolicy.h) for hosts (e.g. Linux) as a test-and-test-and-set spinlock with exponential
+ *    backoff. Suits very short locked sections (like those of the containers) with few threads: Unlike a
+ *    std::mutex, locking never enters the kernel.
+ *
+ *    Waiting threads only read the lock flag, so the cache line stays shared until the lock gets released; only
+ *    then they try to take it by an atomic exchange. After a failed attempt, each thread waits for an increasing
+ *    number of pause instructions, which spreads the attempts of the waiting threads. Once the backoff reached its
+ *    maximum, the thread yields its time slice, so that a preempted lock holder gets the chance to continue.
+ *
+ *    As with @see StdMutex, all users of the same type share one lock; use different tag types for different
+ *    resources.
+ */
+#ifndef APPLICATION_USER_UTIL_MUTEX_SPINLOCKMUTEX_H_
+#define APPLICATION_USER_UTIL_MUTEX_SPINLOCKMUTEX_H_
+
+
+#include <stdint-gcc.h>
+#include <atomic>
+#include <thread>
+
+
+namespace Util {
+	namespace Mutex {
+
+		template <typename TTag = void>
+		class SpinlockMutex {
+
+				/// Maximum number of pause instructions between two attempts.
+				static constexpr uint32_t MaxBackoff = 1024;
+
+				/// The flag gets its own cache line, so that spinning doesn't slow down accesses to neighbouring data.
+				struct alignas(64) Flag {
+					std::atomic<bool> isLocked;
+				};
+				static Flag Lock;
+
+				static inline void pause() {
+					#if defined(__x86_64__) || defined(__i386__)
+						__builtin_ia32_pause();
+					#elif defined(__aarch64__) || defined(__arm__)
+						__asm__ volatile( "yield" );
+					#endif
+				}
+
+			public:
+				static void lock() {
+					uint32_t backoff = 1;
+					while ( Lock.isLocked.exchange(true, std::memory_order_acquire) ) {
+						do {
+							if ( backoff < MaxBackoff ) {
+								for (uint32_t i = 0; i<backoff; i++)  pause();
+								backoff *= 2;
+							} else {
+								std::this_thread::yield();
+							}
+						} while ( Lock.isLocked.load(std::memory_order_relaxed) );
+					}
+				}
+
+				static inline void unlock() {
+					Lock.isLocked.store( false, std::memory_order_release );
+				}
+
+				static inline bool try_lock() {
+					return !Lock.isLocked.load(std::memory_order_relaxed)  &&  !Lock.isLocked.exchange(true, std::memory_order_acquire);
+				}
+
+		};
+
+		template <typename TTag>
+		typename SpinlockMutex<TTag>::Flag SpinlockMutex<TTag>::Lock = { {false} };
+
+	} /* namespace Mutex */
+} /* namespace Util */
+
+
+#endif /* APPLICATION_USER_UTIL_MUTEX_SPINLOCKMUTEX_H_ */
@@ -0,0 +1,54 @@
+/*
+ * StdMutex.h
+ *
+ *  Created on: 16.10.2026
+ *      Author: agent
+ *
+ *  Description:
+ *    Implements a lock policy (@see LockPolicy.h) for hosts (e.g. Linux) using std::mutex, so that the containers
+ *    can be used by several threads.
+ *
+ *    The lock policy's functions are static, thus all users of the same type share one std::mutex. In order to
+ *    protect different resources independently, use different tag types:
+ *
+ *      struct RxTag;
+ *      Fifo<Message, false, 32, StdMutex<RxTag>> rxMessages;
+ */
+#ifndef APPLICATION_USER_UTIL_MUTEX_STDMUTEX_H_
+#define APPLICATION_USER_UTIL_MUTEX_STDMUTEX_H_
+
+
+#include <mutex>
+
+
+namespace Util {
+	namespace Mutex {
+
+		template <typename TTag = void>
+		class StdMutex {
+
+				static std::mutex Mutex;
+
+			public:
+				static inline void lock() {
+					Mutex.lock();
+				}
+
+				static inline void unlock() {
+					Mutex.unlock();
+				}
+
+				static inline bool try_lock() {
+					return Mutex.try_lock();
+				}
+
+		};
+
+		template <typename TTag>
+		std::mutex StdMutex<TTag>::Mutex;
+
+	} /* namespace Mutex */
+} /* namespace Util */
+
+
+#endif /* APPLICATION_USER_UTIL_MUTEX_STDMUTEX_H_ */
@@ -0,0 +1,205 @@
+/*
+ * ArmMutexTest.cpp
+ *
+ *  Created on: 16.10.2026
+ *      Author: agent
+ *
+ *  Description:
+ *  	Tests for the ARM Cortex-M Mutex implementations. Uses a stand-in for the CMSIS core registers and thus needs
+ *  	to be run on the host; @see CmsisStub/cmsis_gcc.h
+ */
+
+#include "CmsisStub/cmsis_gcc.h"
+#define ARM_PRIORITY_CEILING_MUTEX__CM7_R0P1_WORKAROUND  true  // --> The path with more steps; the plain one is a subset
+#include "../ArmInterruptPreventionMutex.h"
+#include "../ArmPriorityCeilingMutex.h"
+#include "../LockPolicy.h"
+#include "ArmMutexTest.h"
+
+#include <Lists/StaticMemory/Fifo.h>
+
+
+namespace Util {
+	namespace Mutex {
+
+		namespace {
+			/// Priority numbers of the simulated interrupts. The logging Fifo is used by the main loop and the logging ISR.
+			constexpr uint8_t MotorControlPriority = 1;
+			constexpr uint8_t LoggingPriority = 6;
+			constexpr uint8_t LoggingCeiling = 5;
+
+			uint32_t MotorControlCount = 0;
+
+			Lists::StaticMemory::Fifo<uint32_t, false, 8, ArmPriorityCeilingMutex<LoggingCeiling>> LogFifo;
+			Lists::StaticMemory::Fifo<uint32_t, false, 8, ArmInterruptPreventionMutex> LogFifoWithoutInterrupts;
+
+			void motorControlIsr() {
+				MotorControlCount++;
+			}
+
+			void loggingIsr() {
+				LogFifo.enqueue( 100 );
+			}
+
+			void loggingIsrWithoutInterrupts() {
+				LogFifoWithoutInterrupts.enqueue( 100 );
+			}
+		}
+
+
+		void ArmMutexTest::assertTrue( bool value ) {
+			if ( !value )  while(1){}
+		}
+
+		void ArmMutexTest::assertEquals( uint32_t expected, uint32_t value ) {
+			if ( expected != value )  while(1){}
+		}
+
+
+		void ArmMutexTest::performAllTests() {
+			performTest_CeilingMasking();
+			performTest_Nesting();
+			performTest_DeferredInterrupts();
+		}
+
+		void ArmMutexTest::performTest_CeilingMasking() {
+			CmsisStub::reset();
+			static_assert( IsLockPolicy<ArmPriorityCeilingMutex<5>>::value, "ArmPriorityCeilingMutex must be a lock policy!" );
+			static_assert( IsLockPolicy<ArmInterruptPreventionMutex>::value, "ArmInterruptPreventionMutex must be a lock policy!" );
+
+			// Only the ceiling and less urgent priorities get masked
+			{
+				LockGuard<ArmPriorityCeilingMutex<5>> _mutex;
+				assertEquals( 0x50, __get_BASEPRI() );
+				assertEquals( 0, __get_PRIMASK() );
+				assertTrue( !CmsisStub::isMasked(0) );
+				assertTrue( !CmsisStub::isMasked(4) );
+				assertTrue( CmsisStub::isMasked(5) );
+				assertTrue( CmsisStub::isMasked(15) );
+			}
+			assertEquals( 0, __get_BASEPRI() );
+			assertTrue( !CmsisStub::isMasked(15) );
+
+			{
+				TryLockGuard<ArmPriorityCeilingMutex<15>> guard;
+				assertTrue( guard.ownsLock() );
+				assertEquals( 0xF0, __get_BASEPRI() );
+				assertTrue( !CmsisStub::isMasked(14) );
+			}
+			assertEquals( 0, __get_BASEPRI() );
+
+			// Everything gets masked
+			{
+				LockGuard<ArmInterruptPreventionMutex> _mutex;
+				assertEquals( 1, __get_PRIMASK() );
+				assertTrue( CmsisStub::isMasked(0) );
+			}
+			assertEquals( 0, __get_PRIMASK() );
+		}
+
+		void ArmMutexTest::performTest_Nesting() {
+			CmsisStub::reset();
+
+			// Same ceiling
+			{
+				LockGuard<ArmPriorityCeilingMutex<5>> outer;
+				{
+					LockGuard<ArmPriorityCeilingMutex<5>> inner;
+					assertEquals( 0x50, __get_BASEPRI() );
+				}
+				assertEquals( 0x50, __get_BASEPRI() );
+			}
+			assertEquals( 0, __get_BASEPRI() );
+
+			// More urgent ceiling inside
+			{
+				LockGuard<ArmPriorityCeilingMutex<5>> outer;
+				{
+					LockGuard<ArmPriorityCeilingMutex<3>> inner;
+					assertEquals( 0x30, __get_BASEPRI() );
+				}
+				assertEquals( 0x50, __get_BASEPRI() );
+			}
+			assertEquals( 0, __get_BASEPRI() );
+
+			// Less urgent ceiling inside: Must not unmask anything
+			{
+				LockGuard<ArmPriorityCeilingMutex<3>> outer;
+				{
+					LockGuard<ArmPriorityCeilingMutex<5>> inner;
+					assertEquals( 0x30, __get_BASEPRI() );
+				}
+				assertEquals( 0x30, __get_BASEPRI() );
+			}
+			assertEquals( 0, __get_BASEPRI() );
+
+			// BASEPRI raised by someone else stays untouched
+			__set_BASEPRI( 0x20 );
+			{
+				LockGuard<ArmPriorityCeilingMutex<5>> _mutex;
+				assertEquals( 0x20, __get_BASEPRI() );
+			}
+			assertEquals( 0x20, __get_BASEPRI() );
+			__set_BASEPRI( 0 );
+
+			// Interrupts disabled before stay disabled
+			{
+				LockGuard<ArmInterruptPreventionMutex> outer;
+				{
+					LockGuard<ArmInterruptPreventionMutex> inner;
+				}
+				assertEquals( 1, __get_PRIMASK() );
+			}
+			assertEquals( 0, __get_PRIMASK() );
+			__disable_irq();
+			{
+				LockGuard<ArmInterruptPreventionMutex> _mutex;
+			}
+			assertEquals( 1, __get_PRIMASK() );
+			{
+				LockGuard<ArmPriorityCeilingMutex<5>> _mutex;  // --> Must not enable the interrupts (erratum workaround)
+				assertEquals( 1, __get_PRIMASK() );
+				assertEquals( 0x50, __get_BASEPRI() );
+			}
+			assertEquals( 1, __get_PRIMASK() );
+			__enable_irq();
+		}
+
+		/**
+		 * While the main loop accesses the logging Fifo, the logging ISR is deferred; the motor control ISR is only
+		 * deferred if all interrupts get disabled.
+		 */
+		void ArmMutexTest::performTest_DeferredInterrupts() {
+			CmsisStub::reset();
+			MotorControlCount = 0;
+			uint32_t value;
+
+			{
+				auto lockedFifo = LogFifo.lock();
+				lockedFifo.enqueue( 1 );
+				assertTrue( !CmsisStub::raiseInterrupt(LoggingPriority, loggingIsr) );
+				assertTrue( CmsisStub::raiseInterrupt(MotorControlPriority, motorControlIsr) );
+				assertEquals( 1, MotorControlCount );
+				lockedFifo.enqueue( 2 );
+				assertEquals( 2, lockedFifo.Count() );
+			}
+			assertEquals( 0, __get_BASEPRI() );
+			assertEquals( 3, LogFifo.Count() );  // --> The logging ISR ran upon unlocking
+			for (uint32_t expected : {1, 2, 100}) {
+				assertTrue( LogFifo.dequeue(&value) );
+				assertEquals( expected, value );
+			}
+
+			{
+				auto lockedFifo = LogFifoWithoutInterrupts.lock();
+				lockedFifo.enqueue( 1 );
+				assertTrue( !CmsisStub::raiseInterrupt(LoggingPriority, loggingIsrWithoutInterrupts) );
+				assertTrue( !CmsisStub::raiseInterrupt(MotorControlPriority, motorControlIsr) );
+				assertEquals( 1, MotorControlCount );
+			}
+			assertEquals( 2, MotorControlCount );
+			assertEquals( 2, LogFifoWithoutInterrupts.Count() );
+		}
+
+	} /* namespace Mutex */
+} /* namespace Util */
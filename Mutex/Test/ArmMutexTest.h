@@ -0,0 +1,40 @@
+/*
+ * ArmMutexTest.h
+ *
+ *  Created on: 16.10.2026
+ *      Author: agent
+ *
+ *  Description:
+ *  	Tests for the ARM Cortex-M Mutex implementations. Uses a stand-in for the CMSIS core registers and thus needs
+ *  	to be run on the host; @see CmsisStub/cmsis_gcc.h
+ */
+
+#ifndef UTIL_MUTEX_TEST_ARM_MUTEX_TEST_H_
+#define UTIL_MUTEX_TEST_ARM_MUTEX_TEST_H_
+
+#include <stdint-gcc.h>
+
+
+namespace Util {
+	namespace Mutex {
+
+		class ArmMutexTest {
+				ArmMutexTest() = delete;
+
+			public:
+				static void performAllTests();
+
+			private:
+				static void assertTrue( bool value );
+				static void assertEquals( uint32_t expected, uint32_t value );
+
+				static void performTest_CeilingMasking();
+				static void performTest_Nesting();
+				static void performTest_DeferredInterrupts();
+
+		};
+
+	} /* namespace Mutex */
+} /* namespace Util */
+
+#endif /* UTIL_MUTEX_TEST_ARM_MUTEX_TEST_H_ */
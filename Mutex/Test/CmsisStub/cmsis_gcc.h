@@ -0,0 +1,136 @@
+/*
+ * cmsis_gcc.h
+ *
+ *  Created on: 16.10.2026
+ *      Author: agent
+ *
+ *  Description:
+ *  	Host-side stand-in for the CMSIS core register functions used by the ARM Mutex implementations. PRIMASK and
+ *  	BASEPRI are plain variables, which behave like the real registers (e.g. unimplemented BASEPRI bits read as
+ *  	zero, BASEPRI_MAX only raises the masking).
+ *
+ *  	Interrupts are simulated by @see CmsisStub::raiseInterrupt(): The handler runs at once if its priority isn't
+ *  	masked; otherwise it stays pending until a register write unmasks it.
+ *
+ *  	Must be included before the Mutex headers, or found instead of the real header by the include path. Must not
+ *  	be used on the target.
+ */
+#ifndef __CMSIS_GCC_H
+#define __CMSIS_GCC_H
+
+
+#include <stdint-gcc.h>
+#include <array>
+
+#ifndef __NVIC_PRIO_BITS
+	#define __NVIC_PRIO_BITS  4
+#endif
+
+
+namespace CmsisStub {
+
+	struct Registers {
+		uint32_t primask;
+		uint32_t basepri;
+	};
+
+	struct PendingInterrupt {
+		uint8_t priority;
+		void ( *handler )();
+	};
+
+	inline Registers& registers() {
+		static Registers coreRegisters = { 0, 0 };
+		return coreRegisters;
+	}
+
+	inline std::array<PendingInterrupt, 8>& pendingInterrupts() {
+		static std::array<PendingInterrupt, 8> interrupts = {};
+		return interrupts;
+	}
+
+	/// Tells if an interrupt with the given priority number would be deferred right now.
+	inline bool isMasked( uint8_t priority ) {
+		if ( registers().primask & UINT32_C(1) )  return true;
+		const uint32_t basepri = registers().basepri;
+		return basepri != 0  &&  (static_cast<uint32_t>(priority) << (8 - __NVIC_PRIO_BITS)) >= basepri;
+	}
+
+	/// Executes all pending interrupts which aren't masked anymore, the most urgent one first.
+	inline void servicePendingInterrupts() {
+		while ( true ) {
+			PendingInterrupt *next = nullptr;
+			for (PendingInterrupt& interrupt : pendingInterrupts())
+				if ( interrupt.handler  &&  !isMasked(interrupt.priority)  &&  (next == nullptr  ||  interrupt.priority < next->priority) )  next = &interrupt;
+			if ( next == nullptr )  return;
+			void ( *handler )() = next->handler;
+			next->handler = nullptr;
+			handler();
+		}
+	}
+
+	/**
+	 * Simulates an interrupt request. The handler is executed at once, or as soon as its priority gets unmasked.
+	 *
+	 * @return                	..	Returns if the handler was executed at once.
+	 */
+	inline bool raiseInterrupt( uint8_t priority, void (*handler)() ) {
+		if ( !isMasked(priority) ) {
+			handler();
+			return true;
+		}
+		for (PendingInterrupt& interrupt : pendingInterrupts()) {
+			if ( interrupt.handler == nullptr ) {
+				interrupt.priority = priority;
+				interrupt.handler = handler;
+				break;
+			}
+		}
+		return false;
+	}
+
+	inline void reset() {
+		registers() = { 0, 0 };
+		pendingInterrupts() = {};
+	}
+
+} /* namespace CmsisStub */
+
+
+inline void __ISB() {}
+
+inline uint32_t __get_PRIMASK() {
+	return CmsisStub::registers().primask;
+}
+
+inline void __set_PRIMASK( uint32_t priMask ) {
+	CmsisStub::registers().primask = priMask & UINT32_C(1);
+	CmsisStub::servicePendingInterrupts();
+}
+
+inline void __disable_irq() {
+	CmsisStub::registers().primask = 1;
+}
+
+inline void __enable_irq() {
+	__set_PRIMASK( 0 );
+}
+
+inline uint32_t __get_BASEPRI() {
+	return CmsisStub::registers().basepri;
+}
+
+inline void __set_BASEPRI( uint32_t basePri ) {
+	CmsisStub::registers().basepri = basePri & (UINT32_C(0xFF) << (8 - __NVIC_PRIO_BITS)) & UINT32_C(0xFF);
+	CmsisStub::servicePendingInterrupts();
+}
+
+/// Writes only if the new value masks more interrupts than the current one.
+inline void __set_BASEPRI_MAX( uint32_t basePri ) {
+	const uint32_t value = basePri & (UINT32_C(0xFF) << (8 - __NVIC_PRIO_BITS)) & UINT32_C(0xFF);
+	const uint32_t current = CmsisStub::registers().basepri;
+	if ( value != 0  &&  (current == 0  ||  value < current) )  CmsisStub::registers().basepri = value;
+}
+
+
+#endif /* __CMSIS_GCC_H */
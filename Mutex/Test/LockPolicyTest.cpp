@@ -0,0 +1,203 @@
+/*
+ * LockPolicyTest.cpp
+ *
+ *  Created on: 16.10.2026
+ *      Author: agent
+ *
+ *  Description:
+ *  	Tests for the lock policy concept and its guards, including a regression test that NoMutex doesn't
+ *  	generate any code.
+ *
+ *  	The code comparison places functions into dedicated sections and compares their machine code. It relies
+ *  	on the GNU linker, which provides __start_/__stop_ symbols for such sections, and is only meaningful for
+ *  	optimized builds; otherwise it is skipped.
+ */
+
+#include "../LockPolicy.h"
+#include "../NoMutex.h"
+#include "LockPolicyTest.h"
+
+#include <Lists/StaticMemory/Fifo.h>
+
+#include <string.h>
+#include <mutex>
+
+
+/// The machine code comparison needs an optimized ELF build without instrumentation. Builds using
+/// -fsanitize=undefined need to define LOCK_POLICY_TEST__COMPARE_CODE=0 (GCC doesn't tell about it).
+#ifndef LOCK_POLICY_TEST__COMPARE_CODE
+	#if defined(__OPTIMIZE__) && defined(__ELF__) && defined(__GNUC__) && !defined(__SANITIZE_ADDRESS__) && !defined(__SANITIZE_THREAD__)
+		#define LOCK_POLICY_TEST__COMPARE_CODE 1
+	#else
+		#define LOCK_POLICY_TEST__COMPARE_CODE 0
+	#endif
+#endif
+
+#if LOCK_POLICY_TEST__COMPARE_CODE
+	#define LOCK_POLICY_TEST__CODE_SECTION(name) __attribute__(( section(#name), noinline, noclone ))
+
+	extern "C" const uint8_t __start_lockPolicyTest_increment[], __stop_lockPolicyTest_increment[];
+	extern "C" const uint8_t __start_lockPolicyTest_incrementNoMutex[], __stop_lockPolicyTest_incrementNoMutex[];
+	extern "C" const uint8_t __start_lockPolicyTest_enqueue[], __stop_lockPolicyTest_enqueue[];
+	extern "C" const uint8_t __start_lockPolicyTest_enqueueGuarded[], __stop_lockPolicyTest_enqueueGuarded[];
+#else
+	#define LOCK_POLICY_TEST__CODE_SECTION(name)
+#endif
+
+
+namespace Util {
+	namespace Mutex {
+
+		namespace {
+			/// Lock policy which keeps track of its state.
+			class RecordingMutex {
+				public:
+					static uint32_t LockCount;
+					static bool IsLocked, IsAvailable;
+
+					static void lock()      { IsLocked = true;  LockCount++; }
+					static void unlock()    { IsLocked = false; }
+					static bool try_lock()  { if ( IsAvailable )  lock();  return IsAvailable; }
+			};
+			uint32_t RecordingMutex::LockCount = 0;
+			bool RecordingMutex::IsLocked = false, RecordingMutex::IsAvailable = true;
+
+			/// The former kind of Mutex: Locks in its constructor; non-static functions.
+			class ConstructorLockingMutex {
+				public:
+					ConstructorLockingMutex()  {}
+					void lock()  {}
+					void unlock()  {}
+					bool try_lock()  { return true; }
+			};
+
+			class MutexWithoutTryLock {
+				public:
+					static void lock()  {}
+					static void unlock()  {}
+			};
+
+			#if LOCK_POLICY_TEST__COMPARE_CODE
+				/// Returns if two code sections have the same size and content.
+				bool haveSameCode( const uint8_t *start1, const uint8_t *stop1, const uint8_t *start2, const uint8_t *stop2 ) {
+					return (stop1 - start1) == (stop2 - start2)  &&  memcmp( start1, start2, static_cast<size_t>(stop1 - start1) ) == 0;
+				}
+			#endif
+		}
+
+
+		// Pairs of functions which must compile to identical machine code. They don't access globals, so that there are
+		// no address dependent instructions, and have external linkage, so that the arguments aren't propagated into them.
+		namespace CodeComparison {
+			using TestFifo = Lists::StaticMemory::Fifo<uint32_t, false, 16, NoMutex>;
+
+			LOCK_POLICY_TEST__CODE_SECTION(lockPolicyTest_increment)
+			void increment( volatile uint32_t *counter ) {
+				*counter = *counter + 1;
+			}
+
+			LOCK_POLICY_TEST__CODE_SECTION(lockPolicyTest_incrementNoMutex)
+			void incrementNoMutex( volatile uint32_t *counter ) {
+				LockGuard<NoMutex> _mutex;
+				*counter = *counter + 1;
+			}
+
+			LOCK_POLICY_TEST__CODE_SECTION(lockPolicyTest_enqueue)
+			bool enqueue( TestFifo *fifo, uint32_t value ) {
+				return fifo->enqueue( value );
+			}
+
+			LOCK_POLICY_TEST__CODE_SECTION(lockPolicyTest_enqueueGuarded)
+			bool enqueueGuarded( TestFifo *fifo, uint32_t value ) {
+				return fifo->lock().enqueue( value );
+			}
+		}
+
+
+		void LockPolicyTest::assertTrue( bool value ) {
+			if ( !value )  while(1){}
+		}
+
+		void LockPolicyTest::assertEquals( uint32_t expected, uint32_t value ) {
+			if ( expected != value )  while(1){}
+		}
+
+
+		void LockPolicyTest::performAllTests() {
+			performTest_ConceptCheck();
+			performTest_Guards();
+			performTest_NoMutexCompilesToNothing();
+		}
+
+		void LockPolicyTest::performTest_ConceptCheck() {
+			static_assert( IsLockPolicy<NoMutex>::value, "" );
+			static_assert( IsLockPolicy<RecordingMutex>::value, "" );
+			static_assert( !IsLockPolicy<ConstructorLockingMutex>::value, "Non-static functions must be rejected!" );
+			static_assert( !IsLockPolicy<MutexWithoutTryLock>::value, "try_lock() is mandatory!" );
+			static_assert( !IsLockPolicy<int>::value, "" );
+		}
+
+		void LockPolicyTest::performTest_Guards() {
+			{
+				LockGuard<RecordingMutex> _mutex;
+				assertTrue( RecordingMutex::IsLocked );
+			}
+			assertTrue( !RecordingMutex::IsLocked );
+
+			{
+				TryLockGuard<RecordingMutex> guard;
+				assertTrue( guard.ownsLock() );
+				assertTrue( RecordingMutex::IsLocked );
+			}
+			assertTrue( !RecordingMutex::IsLocked );
+
+			RecordingMutex::IsAvailable = false;
+			{
+				TryLockGuard<RecordingMutex> guard;
+				assertTrue( !guard );
+			}
+			RecordingMutex::IsAvailable = true;
+			assertEquals( 2, RecordingMutex::LockCount );
+
+			// The standard library's locks work on policy objects, too
+			RecordingMutex policy;
+			{
+				std::lock_guard<RecordingMutex> guard( policy );
+				assertTrue( RecordingMutex::IsLocked );
+			}
+			assertTrue( !RecordingMutex::IsLocked );
+			{
+				std::unique_lock<RecordingMutex> guard( policy, std::try_to_lock );
+				assertTrue( guard.owns_lock() );
+				guard.unlock();
+				assertTrue( !RecordingMutex::IsLocked );
+			}
+			assertEquals( 4, RecordingMutex::LockCount );
+		}
+
+		void LockPolicyTest::performTest_NoMutexCompilesToNothing() {
+			// Neither NoMutex nor its guard carries any state or vptr
+			static_assert( std::is_empty<NoMutex>::value  &&  !std::is_polymorphic<NoMutex>::value, "" );
+			static_assert( std::is_empty<LockGuard<NoMutex>>::value, "" );
+			static_assert( sizeof(Lists::StaticMemory::Fifo<uint8_t, false, 8, NoMutex>) == 8 + 2, "" );
+
+			volatile uint32_t counter = 0;
+			CodeComparison::increment( &counter );
+			CodeComparison::incrementNoMutex( &counter );
+			assertEquals( 2, counter );
+
+			static CodeComparison::TestFifo fifo;
+			assertTrue( CodeComparison::enqueue(&fifo, 1) );
+			assertTrue( CodeComparison::enqueueGuarded(&fifo, 2) );
+			assertEquals( 2, fifo.Count() );
+
+			#if LOCK_POLICY_TEST__COMPARE_CODE
+				assertTrue( haveSameCode(__start_lockPolicyTest_increment, __stop_lockPolicyTest_increment,
+										 __start_lockPolicyTest_incrementNoMutex, __stop_lockPolicyTest_incrementNoMutex) );
+				assertTrue( haveSameCode(__start_lockPolicyTest_enqueue, __stop_lockPolicyTest_enqueue,
+										 __start_lockPolicyTest_enqueueGuarded, __stop_lockPolicyTest_enqueueGuarded) );
+			#endif
+		}
+
+	} /* namespace Mutex */
+} /* namespace Util */
@@ -0,0 +1,40 @@
+/*
+ * LockPolicyTest.h
+ *
+ *  Created on: 16.10.2026
+ *      Author: agent
+ *
+ *  Description:
+ *  	Tests for the lock policy concept and its guards, including a regression test that NoMutex doesn't
+ *  	generate any code.
+ */
+
+#ifndef UTIL_MUTEX_TEST_LOCK_POLICY_TEST_H_
+#define UTIL_MUTEX_TEST_LOCK_POLICY_TEST_H_
+
+#include <stdint-gcc.h>
+
+
+namespace Util {
+	namespace Mutex {
+
+		class LockPolicyTest {
+				LockPolicyTest() = delete;
+
+			public:
+				static void performAllTests();
+
+			private:
+				static void assertTrue( bool value );
+				static void assertEquals( uint32_t expected, uint32_t value );
+
+				static void performTest_ConceptCheck();
+				static void performTest_Guards();
+				static void performTest_NoMutexCompilesToNothing();
+
+		};
+
+	} /* namespace Mutex */
+} /* namespace Util */
+
+#endif /* UTIL_MUTEX_TEST_LOCK_POLICY_TEST_H_ */
@@ -0,0 +1,89 @@
+/*
+ * MutexBenchmark.cpp
+ *
+ *  Created on: 16.10.2026
+ *      Author: agent
+ *
+ *  Description:
+ *  	Contention benchmark of the host Mutex implementations, using a shared Fifo. Uses threads and thus needs
+ *  	to be run on the (Linux) host.
+ */
+
+#include "../StdMutex.h"
+#include "../SpinlockMutex.h"
+#include "../FutexMutex.h"
+#include "MutexBenchmark.h"
+
+#include <Lists/StaticMemory/Fifo.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+#include <stdio.h>
+
+
+namespace Util {
+	namespace Mutex {
+
+		namespace {
+			/// Total number of enqueue+dequeue pairs, split among the threads.
+			constexpr uint32_t OperationCount = 2000000;
+
+			template <typename TMutex>
+			Lists::StaticMemory::Fifo<uint32_t, false, 64, TMutex> SharedFifo;
+		}
+
+
+		/**
+		 * Each thread applies an element and fetches one right afterwards, so that there is always an element to
+		 * fetch. The locked sections are as short as in real applications; the threads mostly compete for the lock.
+		 *
+		 * With more threads than the Fifo's capacity, an enqueue might get rejected. Only accepted elements are
+		 * expected to be dequeued, either by the threads or afterwards.
+		 */
+		template <typename TMutex>
+		double MutexBenchmark::measureMegaOperationsPerSecond( unsigned threadCount ) {
+			auto &fifo = SharedFifo<TMutex>;
+			std::atomic<uint64_t> enqueuedSum(0), dequeuedSum(0);
+			std::vector<std::thread> threads;
+			const uint32_t operationsPerThread = OperationCount / threadCount;
+
+			const auto start = std::chrono::steady_clock::now();
+			for (unsigned t = 0; t<threadCount; t++) {
+				threads.emplace_back( [&fifo, &enqueuedSum, &dequeuedSum, operationsPerThread](){
+					uint64_t enqueued = 0, dequeued = 0;
+					for (uint32_t i = 0; i<operationsPerThread; i++) {
+						uint32_t value = 0;
+						if ( fifo.enqueue(i) )  enqueued += i;
+						if ( fifo.dequeue(&value) )  dequeued += value;
+					}
+					enqueuedSum.fetch_add( enqueued );
+					dequeuedSum.fetch_add( dequeued );
+				} );
+			}
+			for (auto &thread : threads)  thread.join();
+			const std::chrono::duration<double> duration = std::chrono::steady_clock::now() - start;
+
+			uint32_t remaining = 0;
+			while ( fifo.dequeue(&remaining) )  dequeuedSum += remaining;
+			if ( dequeuedSum.load() != enqueuedSum.load() )  printf( "  (ELEMENTS LOST OR DUPLICATED!)\n" );
+			return 2.0 * threadCount * operationsPerThread / duration.count() / 1e6;
+		}
+
+		void MutexBenchmark::performAllBenchmarks( unsigned maxThreadCount ) {
+			if ( maxThreadCount == 0 )  maxThreadCount = 2 * std::thread::hardware_concurrency();
+			if ( maxThreadCount == 0 )  maxThreadCount = 2;
+
+			printf( "Fifo operations under contention (%u operations, %u hardware threads):\n", static_cast<unsigned>(2 * OperationCount), std::thread::hardware_concurrency() );
+			printf( "  threads   StdMutex [M/s]   SpinlockMutex [M/s]   FutexMutex [M/s]\n" );
+			for (unsigned threadCount = 1; threadCount <= maxThreadCount; threadCount *= 2) {
+				const double stdMutex = measureMegaOperationsPerSecond<StdMutex<>>( threadCount );
+				const double spinlock = measureMegaOperationsPerSecond<SpinlockMutex<>>( threadCount );
+				const double futex    = measureMegaOperationsPerSecond<FutexMutex<>>( threadCount );
+				printf( "  %7u   %14.2f   %19.2f   %16.2f\n", threadCount, stdMutex, spinlock, futex );
+			}
+		}
+
+	} /* namespace Mutex */
+} /* namespace Util */
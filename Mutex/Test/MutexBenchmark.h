@@ -0,0 +1,42 @@
+/*
+ * MutexBenchmark.h
+ *
+ *  Created on: 16.10.2026
+ *      Author: agent
+ *
+ *  Description:
+ *  	Contention benchmark of the host Mutex implementations, using a shared Fifo. Uses threads and thus needs
+ *  	to be run on the (Linux) host.
+ */
+
+#ifndef UTIL_MUTEX_TEST_MUTEX_BENCHMARK_H_
+#define UTIL_MUTEX_TEST_MUTEX_BENCHMARK_H_
+
+#include <stdint-gcc.h>
+#include <stddef.h>
+
+
+namespace Util {
+	namespace Mutex {
+
+		class MutexBenchmark {
+				MutexBenchmark() = delete;
+
+			public:
+				/**
+				 * Runs the benchmark with 1..maxThreadCount threads and prints the results to stdout.
+				 *
+				 * @param maxThreadCount 	..	Maximum number of threads. If 0, twice the number of hardware threads is used,
+				 *                       	  	so that the behaviour with preempted lock holders shows up as well.
+				 */
+				static void performAllBenchmarks( unsigned maxThreadCount = 0 );
+
+			private:
+				template <typename TMutex>
+				static double measureMegaOperationsPerSecond( unsigned threadCount );
+		};
+
+	} /* namespace Mutex */
+} /* namespace Util */
+
+#endif /* UTIL_MUTEX_TEST_MUTEX_BENCHMARK_H_ */
@@ -0,0 +1,109 @@
+/*
+ * MutexTest.cpp
+ *
+ *  Created on: 16.10.2026
+ *      Author: agent
+ *
+ *  Description:
+ *  	Tests for the host Mutex implementations. Uses threads and thus needs to be run on the (Linux) host.
+ */
+
+#include "../StdMutex.h"
+#include "../SpinlockMutex.h"
+#include "../FutexMutex.h"
+#include "../LockPolicy.h"
+#include "MutexTest.h"
+
+#include <Lists/StaticMemory/Fifo.h>
+
+#include <thread>
+#include <vector>
+
+
+namespace Util {
+	namespace Mutex {
+
+		namespace {
+			constexpr unsigned ThreadCount = 4;
+
+			/// Increments a plain counter from several threads. Without mutual exclusion, increments get lost.
+			template <typename TMutex>
+			uint32_t incrementConcurrently( uint32_t incrementsPerThread ) {
+				static uint32_t counter;
+				counter = 0;
+				std::vector<std::thread> threads;
+				for (unsigned t = 0; t<ThreadCount; t++) {
+					threads.emplace_back( [incrementsPerThread](){
+						for (uint32_t i = 0; i<incrementsPerThread; i++) {
+							LockGuard<TMutex> _mutex;  // Locks the following code section; upon destruction the section gets unlocked automatically.
+							counter++;
+						}
+					} );
+				}
+				for (auto &thread : threads)  thread.join();
+				return counter;
+			}
+
+			/// Passes elements from several producers to several consumers, and returns if each one arrived exactly once.
+			template <typename TMutex>
+			bool transferThroughFifo( uint32_t elementsPerProducer ) {
+				static Lists::StaticMemory::Fifo<uint32_t, false, 16, TMutex> fifo;
+				std::vector<std::thread> threads;
+				std::vector<uint8_t> received( ThreadCount * elementsPerProducer, 0 );
+
+				for (unsigned t = 0; t<ThreadCount; t++) {
+					threads.emplace_back( [t, elementsPerProducer](){
+						for (uint32_t i = 0; i<elementsPerProducer; ) {
+							if ( fifo.enqueue(t * elementsPerProducer + i) )  i++;
+							else  std::this_thread::yield();
+						}
+					} );
+					threads.emplace_back( [&received, elementsPerProducer](){
+						for (uint32_t i = 0; i<elementsPerProducer; ) {
+							uint32_t value;
+							if ( fifo.dequeue(&value) ) {
+								received[value]++;  // --> Each value is received by one consumer only, thus no race
+								i++;
+							} else {
+								std::this_thread::yield();
+							}
+						}
+					} );
+				}
+				for (auto &thread : threads)  thread.join();
+
+				for (uint8_t count : received)
+					if ( count != 1 )  return false;
+				return fifo.isEmpty();
+			}
+		}
+
+
+		void MutexTest::assertTrue( bool value ) {
+			if ( !value )  while(1){}
+		}
+
+		void MutexTest::assertEquals( uint32_t expected, uint32_t value ) {
+			if ( expected != value )  while(1){}
+		}
+
+
+		void MutexTest::performAllTests() {
+			performTest_MutualExclusion();
+			performTest_ThreadSafeFifo();
+		}
+
+		void MutexTest::performTest_MutualExclusion() {
+			assertEquals( ThreadCount * 200000, incrementConcurrently<StdMutex<>>(200000) );
+			assertEquals( ThreadCount * 200000, incrementConcurrently<SpinlockMutex<>>(200000) );
+			assertEquals( ThreadCount * 200000, incrementConcurrently<FutexMutex<>>(200000) );
+		}
+
+		void MutexTest::performTest_ThreadSafeFifo() {
+			assertTrue( transferThroughFifo<StdMutex<>>(50000) );
+			assertTrue( transferThroughFifo<SpinlockMutex<>>(50000) );
+			assertTrue( transferThroughFifo<FutexMutex<>>(50000) );
+		}
+
+	} /* namespace Mutex */
+} /* namespace Util */
@@ -0,0 +1,38 @@
+/*
+ * MutexTest.h
+ *
+ *  Created on: 16.10.2026
+ *      Author: agent
+ *
+ *  Description:
+ *  	Tests for the host Mutex implementations. Uses threads and thus needs to be run on the (Linux) host.
+ */
+
+#ifndef UTIL_MUTEX_TEST_MUTEX_TEST_H_
+#define UTIL_MUTEX_TEST_MUTEX_TEST_H_
+
+#include <stdint-gcc.h>
+
+
+namespace Util {
+	namespace Mutex {
+
+		class MutexTest {
+				MutexTest() = delete;
+
+			public:
+				static void performAllTests();
+
+			private:
+				static void assertTrue( bool value );
+				static void assertEquals( uint32_t expected, uint32_t value );
+
+				static void performTest_MutualExclusion();
+				static void performTest_ThreadSafeFifo();
+
+		};
+
+	} /* namespace Mutex */
+} /* namespace Util */
+
+#endif /* UTIL_MUTEX_TEST_MUTEX_TEST_H_ */
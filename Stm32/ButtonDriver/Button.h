@@ -13,7 +13,8 @@
  *  	 Further information:
  *  	 - each instance of this class represents one button,
  *  	 - each instance's main() function must be called cyclically from main loop,
- *  	 - no usage of dynamic (heap) memory.
+ *  	 - no usage of dynamic (heap) memory,
+ *  	 - buttons may be chained (without copying) in an @see IntrusiveList<Button>, e.g. to call all main() functions in one go.
  */
 #ifndef APPLICATION_USER_HARDWARE_BUTTONDRIVER_BUTTONDRIVER_H_
 #define APPLICATION_USER_HARDWARE_BUTTONDRIVER_BUTTONDRIVER_H_
@@ -23,13 +24,15 @@
 
 #include <stdint-gcc.h>
 
+#include <Lists/StaticMemory/IntrusiveList.h>
+
 
 
 namespace Util {
 	namespace Stm32 {
 		namespace ButtonDriver {
 
-			class Button {
+			class Button : public Util::Lists::StaticMemory::IntrusiveListHook<> {
 				private:
 
 					/// This construct allows the application to access the button state as follows: 'buttonInstance.State.xx'
@@ -14,6 +14,7 @@
  *  	Further information:
  *  	- no usage of dynamic (heap) memory,
  *  	- data members may be accessed using the "->" operator.  Example: mem1->a = 10;
+ *  	- instances may be chained (without copying) in an @see IntrusiveList<PersistentStorage<T>>.
  */
 #ifndef APPLICATION_USER_PERSISTENCEMANAGER_STM32_STM32PERSISTENCEMANAGER_H_
 #define APPLICATION_USER_PERSISTENCEMANAGER_STM32_STM32PERSISTENCEMANAGER_H_
@@ -26,13 +27,15 @@
 #include <string.h>
 #include <type_traits>
 
+#include <Lists/StaticMemory/IntrusiveList.h>
+
 
 namespace Util {
 	namespace Stm32 {
 		namespace Persistence {
 
 			/// This class represents a persistent storage. It may be instanciated as often as desired. Calling its destructor is not allowed.
-			template <typename T> class PersistentStorage {
+			template <typename T> class PersistentStorage : public Util::Lists::StaticMemory::IntrusiveListHook<> {
 				friend class Internal;
 
 				public:
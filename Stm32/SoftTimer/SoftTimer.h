@@ -8,17 +8,20 @@
  *		This class provides a software timer that (if enabled) cyclically
  *		invokes a callback function.
  *		For proper functioning, the main() function must be called from main-loop.
+ *		Timers may be chained (without copying) in an @see IntrusiveList<SoftTimer>, e.g. by a scheduler.
  */
 #ifndef APPLICATION_USER_STM32SOFTTIMER_TIMER_H_
 #define APPLICATION_USER_STM32SOFTTIMER_TIMER_H_
 
 #include <stdint-gcc.h>
 
+#include <Lists/StaticMemory/IntrusiveList.h>
+
 
 namespace Util {
 	namespace Stm32 {
 
-		class SoftTimer {
+		class SoftTimer : public Util::Lists::StaticMemory::IntrusiveListHook<> {
 
 			public:
 				typedef void (*CallbackDefinition)(SoftTimer &);
@@ -0,0 +1,105 @@
+/*
+ * StringHashingTest.cpp
+ *
+ *  Created on: 17.10.2026
+ *      Author: agent
+ *
+ *  Description:
+ *  	Tests for compile-time string hashing and the hashed command lookup.
+ */
+
+#include "../string_hashing.h"
+#include "StringHashingTest.h"
+
+
+namespace StringUtil {
+
+	namespace {
+		using namespace hash_literals;
+
+		// The following checks are evaluated at compile time
+		static_assert( hash_string("", 0) == UINT32_C(0x811C9DC5), "FNV-1a offset basis" );
+		static_assert( hash_string("a") == UINT32_C(0xE40C292C), "FNV-1a check value" );
+		static_assert( hash_string("foobar") == UINT32_C(0xBF9CF968), "FNV-1a check value" );
+		static_assert( "x"_hash == hash_string("x"), "" );
+		static_assert( "reset"_hash == hash_string("reset", 5), "" );
+		static_assert( hash_string("costarring") == hash_string("liquid"), "Known FNV-1a collision, used below" );
+
+		constexpr Command<uint32_t> Commands[] = { {"help", 1}, {"reset", 2}, {"status", 3}, {"set", 4}, {"get", 5} };
+		constexpr auto KnownCommands = make_command_table( Commands );
+	}
+
+
+	void StringHashingTest::assertTrue( bool value ) {
+		if ( !value )  while(1){}
+	}
+
+	void StringHashingTest::assertEquals( uint32_t expected, uint32_t value ) {
+		if ( expected != value )  while(1){}
+	}
+
+
+	void StringHashingTest::performAllTests() {
+		performTest_HashValues();
+		performTest_TokenEquals();
+		performTest_CommandTable();
+		performTest_CollidingCommands();
+	}
+
+	void StringHashingTest::performTest_HashValues() {
+		volatile size_t length = 6;  // Enforces evaluation at runtime
+		assertEquals( 0xBF9CF968, hash_string("foobar", length) );
+		assertEquals( "foobar"_hash, hash_string("foobar", length) );
+	}
+
+	void StringHashingTest::performTest_TokenEquals() {
+		assertTrue( token_equals("reset", 5, "reset") );
+		assertTrue( token_equals("reset now", 5, "reset") );  // --> The token doesn't need to be null-terminated
+		assertTrue( !token_equals("rese", 4, "reset") );       // --> Prefix of the string
+		assertTrue( !token_equals("resets", 6, "reset") );     // --> Longer than the string
+		assertTrue( !token_equals("resex", 5, "reset") );
+		assertTrue( token_equals("", 0, "") );
+		assertTrue( !token_equals("", 0, "reset") );
+	}
+
+	void StringHashingTest::performTest_CommandTable() {
+		const char line[] = "status resets rese set";
+
+		// Hits
+		assertEquals( 1, KnownCommands.find("help", 4) );
+		assertEquals( 2, KnownCommands.find("reset", 5) );
+		assertEquals( 3, KnownCommands.find(line, 6) );
+		assertEquals( 4, KnownCommands.find(&line[19], 3) );
+		assertEquals( 5, KnownCommands.find("get", 3) );
+		assertTrue( KnownCommands.find_command("set", 3) != nullptr );
+		assertTrue( token_equals("set", 3, KnownCommands.find_command("set", 3)->name) );
+
+		// Misses, including prefixes and longer tokens
+		assertEquals( 0, KnownCommands.find(&line[7], 6) );   // --> "resets"
+		assertEquals( 0, KnownCommands.find(&line[14], 4) );  // --> "rese"
+		assertEquals( 0, KnownCommands.find("se", 2) );
+		assertEquals( 0, KnownCommands.find("", 0) );
+		assertEquals( 0, KnownCommands.find("unknown", 7) );
+		assertTrue( KnownCommands.find_command("rese", 4) == nullptr );
+		assertTrue( KnownCommands.find_command(nullptr, 0) == nullptr );
+	}
+
+	/**
+	 * Colliding names cause a compile error in constexpr tables; others must still find both commands.
+	 */
+	void StringHashingTest::performTest_CollidingCommands() {
+		const Command<uint32_t> colliding[] = { {"costarring", 1}, {"liquid", 2}, {"help", 3} };
+		const auto table = make_command_table( colliding );
+
+		assertEquals( 1, table.find("costarring", 10) );
+		assertEquals( 2, table.find("liquid", 6) );
+		assertEquals( 3, table.find("help", 4) );
+		assertEquals( 0, table.find("liqui", 5) );
+
+		const Command<uint32_t> reversed[] = { {"liquid", 2}, {"costarring", 1} };
+		const auto reversedTable = make_command_table( reversed );
+		assertEquals( 1, reversedTable.find("costarring", 10) );
+		assertEquals( 2, reversedTable.find("liquid", 6) );
+	}
+
+} /* namespace StringUtil */
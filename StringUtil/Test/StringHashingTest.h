@@ -0,0 +1,38 @@
+/*
+ * StringHashingTest.h
+ *
+ *  Created on: 17.10.2026
+ *      Author: agent
+ *
+ *  Description:
+ *  	Tests for compile-time string hashing and the hashed command lookup.
+ */
+
+#ifndef UTIL_STRINGUTIL_TEST_STRING_HASHING_TEST_H_
+#define UTIL_STRINGUTIL_TEST_STRING_HASHING_TEST_H_
+
+#include <stdint-gcc.h>
+
+
+namespace StringUtil {
+
+	class StringHashingTest {
+			StringHashingTest() = delete;
+
+		public:
+			static void performAllTests();
+
+		private:
+			static void assertTrue( bool value );
+			static void assertEquals( uint32_t expected, uint32_t value );
+
+			static void performTest_HashValues();
+			static void performTest_TokenEquals();
+			static void performTest_CommandTable();
+			static void performTest_CollidingCommands();
+
+	};
+
+} /* namespace StringUtil */
+
+#endif /* UTIL_STRINGUTIL_TEST_STRING_HASHING_TEST_H_ */
@@ -0,0 +1,189 @@
+/*
+ * string_hashing.h
+ *
+ *  Created on: 16.10.2026
+ *      Author: agent
+ *
+ *  Description:
+ *    This module provides string hashing (FNV-1a, 32 bits) that can be performed both at compile time and at
+ *    runtime. It allows to look up commands (e.g. tokens obtained by @see get_parameter) with one hash and one
+ *    string compare, instead of comparing against each known command.
+ *
+ *    Example 1 - switch statement. Hash collisions of the command names are detected by the compiler as
+ *    duplicate case values:
+ *
+ *      using namespace StringUtil::hash_literals;
+ *      uint_fast16_t length;
+ *      char *token = StringUtil::get_parameter( line, -1, 0, &length );
+ *      switch ( StringUtil::hash_string(token, length) ) {
+ *        case "help"_hash:   if ( StringUtil::token_equals(token, length, "help") )  printHelp();   break;
+ *        case "reset"_hash:  if ( StringUtil::token_equals(token, length, "reset") ) doReset();     break;
+ *      }
+ *
+ *    Example 2 - command table. Hash collisions are detected when the table gets created at compile time, thus the
+ *    table should be declared constexpr:
+ *
+ *      constexpr StringUtil::Command<void(*)(void)> Commands[] = { {"help", printHelp}, {"reset", doReset} };
+ *      constexpr auto CommandTable = StringUtil::make_command_table( Commands );
+ *      auto handler = CommandTable.find( token, length );   // --> nullptr if unknown
+ */
+#ifndef APPLICATION_USER_STRING_FUNCTIONS_STRING_HASHING_H_
+#define APPLICATION_USER_STRING_FUNCTIONS_STRING_HASHING_H_
+
+#include <stdint-gcc.h>
+#include <stddef.h>
+#include <string.h>
+
+
+namespace StringUtil {
+
+	/**
+	 * Determines the FNV-1a hash of a string.
+	 *
+	 * @param string        	..	The string; doesn't need to be null-terminated.
+	 * @param string_length 	..	Length of the string.
+	 *
+	 * @return             	..	Hash value
+	 */
+	constexpr uint32_t hash_string(const char *string, size_t string_length) {
+		uint32_t hash = UINT32_C(2166136261);
+		for (size_t i = 0; i<string_length; i++) {
+			hash ^= static_cast<uint8_t>( string[i] );
+			hash *= UINT32_C(16777619);
+		}
+		return hash;
+	}
+
+	/**
+	 * Determines the FNV-1a hash of a string literal (without null-terminator).
+	 */
+	template <size_t N>
+	constexpr uint32_t hash_string(const char (&literal)[N]) {
+		return hash_string( literal, N - 1 );
+	}
+
+	/**
+	 * Returns if a token of a given length equals a null-terminated string.
+	 *
+	 * @param token          	..	The token, e.g. as returned by @see get_parameter. Doesn't need to be null-terminated.
+	 * @param token_length   	..	Length of the token.
+	 * @param string         	..	Null-terminated string to compare with.
+	 */
+	inline bool token_equals(const char *token, size_t token_length, const char *string) {
+		return strncmp( token, string, token_length ) == 0  &&  string[token_length] == '\0';
+	}
+
+	namespace hash_literals {
+		/**
+		 * Allows to write the hash of a string literal as  "command"_hash , e.g. as case label.
+		 */
+		constexpr uint32_t operator "" _hash(const char *literal, size_t length) {
+			return hash_string( literal, length );
+		}
+	} /* namespace hash_literals */
+
+
+
+	/// Entry of a command table, @see make_command_table
+	template <typename THandler>
+	struct Command {
+		const char *name;
+		THandler    handler;
+	};
+
+
+	namespace internal {
+		/// Intentionally not constexpr: Calling this function within a constant expression causes a compile error.
+		inline void command_hash_collision_detected() {}
+
+		constexpr size_t string_length(const char *string) {
+			size_t length = 0;
+			while ( string[length] != '\0' )  length++;
+			return length;
+		}
+
+		/// Smallest power of two which provides at least two slots per command.
+		constexpr size_t slot_count(size_t command_count) {
+			size_t slots = 2;
+			while ( slots < 2 * command_count )  slots *= 2;
+			return slots;
+		}
+	} /* namespace internal */
+
+
+	/**
+	 * Open-addressing hash table over a fixed set of commands. Create it using @see make_command_table.
+	 * The table occupies at most half of its slots, so that a lookup usually hits at the first probe.
+	 */
+	template <typename THandler, size_t TCommandCount>
+	class CommandTable {
+			static_assert( TCommandCount > 0  &&  TCommandCount < UINT16_MAX, "Invalid number of commands!" );
+
+			static constexpr size_t   SlotCount = internal::slot_count( TCommandCount );
+			static constexpr uint16_t EmptySlot = UINT16_MAX;
+
+			Command<THandler> _commands[TCommandCount];
+			uint32_t          _hashes[TCommandCount];
+			uint16_t          _slots[SlotCount];    ///< Contains command indices, or EmptySlot.
+
+		public:
+			constexpr CommandTable(const Command<THandler> (&commands)[TCommandCount]) : _commands(), _hashes(), _slots() {
+				for (size_t slot = 0; slot<SlotCount; slot++)
+					_slots[slot] = EmptySlot;
+
+				for (size_t i = 0; i<TCommandCount; i++) {
+					_commands[i] = commands[i];
+					_hashes[i] = hash_string( commands[i].name, internal::string_length(commands[i].name) );
+					for (size_t j = 0; j<i; j++)
+						if ( _hashes[j] == _hashes[i] )
+							internal::command_hash_collision_detected();  // ---> If compilation stops here, two commands share the same hash (or a name is duplicated).
+
+					size_t slot = _hashes[i] & (SlotCount - 1);
+					while ( _slots[slot] != EmptySlot )  slot = (slot + 1) & (SlotCount - 1);
+					_slots[slot] = static_cast<uint16_t>( i );
+				}
+			}
+
+			/**
+			 * Looks up a token.
+			 *
+			 * @param token          	..	The token, e.g. as returned by @see get_parameter. Doesn't need to be null-terminated.
+			 * @param token_length   	..	Length of the token.
+			 *
+			 * @return              	..	Pointer to the matching command. Will be nullptr if the token is unknown.
+			 */
+			const Command<THandler> *find_command(const char *token, size_t token_length) const {
+				if ( token == nullptr )  return nullptr;
+				const uint32_t hash = hash_string( token, token_length );
+				for (size_t slot = hash & (SlotCount - 1); _slots[slot] != EmptySlot; slot = (slot + 1) & (SlotCount - 1)) {
+					const uint16_t index = _slots[slot];
+					if ( _hashes[index] == hash  &&  token_equals(token, token_length, _commands[index].name) )
+						return &_commands[index];   // --> Otherwise keep probing; a colliding command may follow.
+				}
+				return nullptr;
+			}
+
+			/**
+			 * Looks up a token and returns the handler of the matching command, or a value-initialized handler
+			 * (e.g. nullptr) if the token is unknown.
+			 */
+			THandler find(const char *token, size_t token_length) const {
+				const Command<THandler> *command = find_command( token, token_length );
+				return command  ?  command->handler  :  THandler{};
+			}
+	};
+
+
+	/**
+	 * Creates a @see CommandTable. The table should be declared constexpr: Only then colliding command hashes (and
+	 * duplicated names) cause a compile error. Lookups in non-constexpr tables are correct despite collisions, but
+	 * duplicated names remain undetected.
+	 */
+	template <typename THandler, size_t TCommandCount>
+	constexpr CommandTable<THandler, TCommandCount> make_command_table(const Command<THandler> (&commands)[TCommandCount]) {
+		return CommandTable<THandler, TCommandCount>( commands );
+	}
+
+} /* namespace StringUtil */
+
+#endif /* APPLICATION_USER_STRING_FUNCTIONS_STRING_HASHING_H_ */